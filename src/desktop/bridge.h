@@ -41,6 +41,7 @@ void fmc_setLedBrightness(void* fmcHandle, int ledId, uint8_t brightness);
 bool fmc_writeData(void* fmcHandle, const uint8_t* data, int length);
 void fmc_setFont(void* fmcHandle, int fontType);
 void fmc_setFontUpdatingEnabled(void* fmcHandle, bool enabled);
+void fmc_setMaxRefreshRate(void* fmcHandle, int framesPerSecond);
 
 // FCU-EFIS functions via handle
 void fcuefis_clear(void* fcuefisHandle);
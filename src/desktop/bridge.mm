@@ -233,8 +233,7 @@ void fmc_setLedBrightness(void* fmcHandle, int ledId, uint8_t brightness) {
 bool fmc_writeData(void* fmcHandle, const uint8_t* data, int length) {
     if (!fmcHandle || !data || length <= 0) return false;
     auto fmc = static_cast<ProductFMC*>(fmcHandle);
-    std::vector<uint8_t> dataVector(data, data + length);
-    return fmc->writeData(dataVector);
+    return fmc->writeReport({data, static_cast<size_t>(length)});
 }
 
 void fmc_setFont(void* fmcHandle, int fontType) {
@@ -271,8 +270,7 @@ void fmc_setFont(void* fmcHandle, int fontType) {
             break;
     }
     
-    auto glyphData = Font::GlyphData(variant, fmc->identifierByte);
-    fmc->setFont(glyphData);
+    fmc->setFont(variant);
 }
 
 void fmc_setFontUpdatingEnabled(void* fmcHandle, bool enabled) {
@@ -281,6 +279,12 @@ void fmc_setFontUpdatingEnabled(void* fmcHandle, bool enabled) {
     fmc->fontUpdatingEnabled = enabled;
 }
 
+void fmc_setMaxRefreshRate(void* fmcHandle, int framesPerSecond) {
+    if (!fmcHandle || framesPerSecond < 0) return;
+    auto fmc = static_cast<ProductFMC*>(fmcHandle);
+    fmc->setMaxRefreshRate(framesPerSecond);
+}
+
 
 // Device enumeration and info functions
 int getDeviceCount() {
@@ -2,10 +2,13 @@
 
 #include "config.h"
 #include "dataref.h"
+#include "hidcapture.h"
 #include "usbcontroller.h"
 #include "usbdevice.h"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <XPLMProcessing.h>
 
 AppState *AppState::instance = nullptr;
@@ -48,12 +51,15 @@ void AppState::deinitialize() {
     debug_force("Plugin deinitializing...\n");
     XPLMUnregisterFlightLoopCallback(AppState::Update, nullptr);
 
+    HIDCapture::getInstance()->stop();
     USBController::getInstance()->destroy();
 
     Dataref::getInstance()->destroyAllBindings();
 
     pluginInitialized = false;
     instance = nullptr;
+
+    std::lock_guard<std::mutex> lock(taskQueueMutex);
     taskQueue.clear();
 }
 
@@ -71,22 +77,30 @@ float AppState::Update(float inElapsedSinceLastCall, float inElapsedTimeSinceLas
 
 void AppState::update() {
     auto now = std::chrono::steady_clock::now();
-    for (auto &task : taskQueue) {
-        if (now >= task.runAt && task.func) {
+
+    // Take the due tasks out first, they may schedule new ones while running
+    std::vector<DelayedTask> dueTasks;
+    {
+        std::lock_guard<std::mutex> lock(taskQueueMutex);
+        auto firstDue = std::stable_partition(taskQueue.begin(), taskQueue.end(), [&](auto &task) {
+            return now < task.runAt;
+        });
+        std::move(firstDue, taskQueue.end(), std::back_inserter(dueTasks));
+        taskQueue.erase(firstDue, taskQueue.end());
+    }
+
+    for (auto &task : dueTasks) {
+        if (task.func) {
             task.func();
         }
     }
 
-    taskQueue.erase(std::remove_if(taskQueue.begin(), taskQueue.end(), [&](auto &task) {
-                        return now >= task.runAt;
-                    }),
-                    taskQueue.end());
-
     if (!pluginInitialized) {
         return;
     }
 
     Dataref::getInstance()->update();
+    USBController::getInstance()->update();
 
     for (auto device : USBController::getInstance()->devices) {
         device->update();
@@ -94,6 +108,7 @@ void AppState::update() {
 }
 
 void AppState::executeAfter(int milliseconds, std::function<void()> func) {
+    std::lock_guard<std::mutex> lock(taskQueueMutex);
     taskQueue.push_back({"",
                          std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds),
                          func});
@@ -101,6 +116,7 @@ void AppState::executeAfter(int milliseconds, std::function<void()> func) {
 
 void AppState::executeAfterDebounced(std::string taskName, int milliseconds, std::function<void()> func) {
     auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(taskQueueMutex);
     auto it = std::find_if(taskQueue.begin(), taskQueue.end(), [&](const DelayedTask &t) {
         return t.name == taskName;
     });
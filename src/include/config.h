@@ -46,4 +46,13 @@
 #define REFRESH_INTERVAL_SECONDS_SLOW 5.0
 #define REFRESH_INTERVAL_SECONDS_FAST 0.05
 
+// Most MCDU screen redraws per second, per device (winwing/settings/<device>/max_refresh_rate). 0 redraws on every change.
+#define FMC_MAX_REFRESH_RATE 20
+
 #define WINWING_VENDOR_ID 0x4098
+
+// Plugin I/O threads, applied by ThreadPolicy. The affinity is a CPU bit mask, 0 leaves placement to the OS.
+// Priorities: 0 = normal, 1 = elevated, 2 = realtime. A level that isn't permitted falls back to the next one down.
+#define THREAD_AFFINITY_MASK 0
+#define THREAD_PRIORITY_DEVICE_IO 1
+#define THREAD_PRIORITY_BACKGROUND 0
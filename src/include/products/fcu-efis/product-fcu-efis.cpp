@@ -7,6 +7,7 @@
 #include "profiles/toliss-fcu-efis-profile.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <iomanip>
 #include <sstream>
@@ -80,8 +81,8 @@ std::vector<uint8_t> encodeStringEfis(int numSegments, const std::string &str) {
     return result;
 }
 
-ProductFCUEfis::ProductFCUEfis(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) :
-    USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
+ProductFCUEfis::ProductFCUEfis(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity) :
+    USBDevice(hidDevice, vendorId, productId, vendorName, productName, identity) {
     profile = nullptr;
     displayData = {};
     lastUpdateCycle = 0;
@@ -104,7 +105,11 @@ void ProductFCUEfis::setProfileForCurrentAircraft() {
     } else {
         debug("No profile found for %s.\n", classIdentifier());
         clearDisplays();
+        return;
     }
+
+    // Align the sim with the switches as they are now, not after the first knob touch
+    forceStateSync();
 }
 
 const char *ProductFCUEfis::classIdentifier() {
@@ -126,10 +131,7 @@ bool ProductFCUEfis::connect() {
         setLedBrightness(FCUEfisLed::EXPED_GREEN, 0);
         setLedBrightness(FCUEfisLed::EXPED_BACKLIGHT, 255);
 
-        if (!profile) {
-            setProfileForCurrentAircraft();
-        }
-
+        // The profile is bound from update(), on the main thread
         return true;
     }
 
@@ -175,14 +177,51 @@ void ProductFCUEfis::disconnect() {
         setLedBrightness(led, 0);
     }
 
-    clearDisplays();
+    // Blanks the displays too, without a profile nothing was ever shown on them
+    unloadProfile();
 
-    if (profile) {
-        delete profile;
-        profile = nullptr;
+    USBDevice::disconnect();
+}
+
+void ProductFCUEfis::unloadProfile() {
+    profileReady = false;
+
+    if (!profile) {
+        return;
     }
 
-    USBDevice::disconnect();
+    delete profile;
+    profile = nullptr;
+
+    const FCUEfisLed annunciatorLeds[] = {
+        FCUEfisLed::LOC_GREEN,
+        FCUEfisLed::AP1_GREEN,
+        FCUEfisLed::AP2_GREEN,
+        FCUEfisLed::ATHR_GREEN,
+        FCUEfisLed::EXPED_GREEN,
+        FCUEfisLed::APPR_GREEN,
+        FCUEfisLed::EFISR_FD_GREEN,
+        FCUEfisLed::EFISR_LS_GREEN,
+        FCUEfisLed::EFISR_CSTR_GREEN,
+        FCUEfisLed::EFISR_WPT_GREEN,
+        FCUEfisLed::EFISR_VORD_GREEN,
+        FCUEfisLed::EFISR_NDB_GREEN,
+        FCUEfisLed::EFISR_ARPT_GREEN,
+        FCUEfisLed::EFISL_FD_GREEN,
+        FCUEfisLed::EFISL_LS_GREEN,
+        FCUEfisLed::EFISL_CSTR_GREEN,
+        FCUEfisLed::EFISL_WPT_GREEN,
+        FCUEfisLed::EFISL_VORD_GREEN,
+        FCUEfisLed::EFISL_NDB_GREEN,
+        FCUEfisLed::EFISL_ARPT_GREEN};
+
+    for (auto led : annunciatorLeds) {
+        setLedBrightness(led, 0);
+    }
+
+    lastUpdateCycle = 0;
+    resetSwitchState();
+    clearDisplays();
 }
 
 void ProductFCUEfis::update() {
@@ -251,7 +290,7 @@ void ProductFCUEfis::initializeDisplays() {
     // Initialize displays with proper init sequence
     std::vector<uint8_t> initCmd = {
         0xF0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    writeData(initCmd);
+    writeData(initCmd, USBWritePriority::Display);
 }
 
 void ProductFCUEfis::clearDisplays() {
@@ -276,7 +315,7 @@ void ProductFCUEfis::sendFCUDisplay(const std::string &speed, const std::string
     auto vsData = encodeStringSwapped(4, fixStringLength(vs, 4));
 
     // Create flag bytes array
-    std::vector<uint8_t> flagBytes(17, 0);
+    std::array<uint8_t, 17> flagBytes = {};
 
     // Set flags based on display data
     if (displayData.spdMach) {
@@ -362,51 +401,42 @@ void ProductFCUEfis::sendFCUDisplay(const std::string &speed, const std::string
     }
 
     // First request - send display data
-    std::vector<uint8_t> data1 = {
+    std::array<uint8_t, 64> data1 = {
         0xF0, 0x00, packetNumber, 0x31, ProductFCUEfis::IdentifierByte, 0xBB, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
     // Add speed data (3 bytes)
-    data1.push_back(speedData[2]);
-    data1.push_back(speedData[1] | flagBytes[static_cast<int>(DisplayByteIndex::S1)]);
-    data1.push_back(speedData[0]);
+    data1[25] = speedData[2];
+    data1[26] = speedData[1] | flagBytes[static_cast<int>(DisplayByteIndex::S1)];
+    data1[27] = speedData[0];
 
     // Add heading data (4 bytes)
-    data1.push_back(headingData[3] | flagBytes[static_cast<int>(DisplayByteIndex::H3)]);
-    data1.push_back(headingData[2]);
-    data1.push_back(headingData[1]);
-    data1.push_back(headingData[0] | flagBytes[static_cast<int>(DisplayByteIndex::H0)]);
+    data1[28] = headingData[3] | flagBytes[static_cast<int>(DisplayByteIndex::H3)];
+    data1[29] = headingData[2];
+    data1[30] = headingData[1];
+    data1[31] = headingData[0] | flagBytes[static_cast<int>(DisplayByteIndex::H0)];
 
     // Add altitude data (6 bytes)
-    data1.push_back(altitudeData[5] | flagBytes[static_cast<int>(DisplayByteIndex::A5)]);
-    data1.push_back(altitudeData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A4)]);
-    data1.push_back(altitudeData[3] | flagBytes[static_cast<int>(DisplayByteIndex::A3)]);
-    data1.push_back(altitudeData[2] | flagBytes[static_cast<int>(DisplayByteIndex::A2)]);
-    data1.push_back(altitudeData[1] | flagBytes[static_cast<int>(DisplayByteIndex::A1)]);
-    data1.push_back(altitudeData[0] | vsData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A0)]);
+    data1[32] = altitudeData[5] | flagBytes[static_cast<int>(DisplayByteIndex::A5)];
+    data1[33] = altitudeData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A4)];
+    data1[34] = altitudeData[3] | flagBytes[static_cast<int>(DisplayByteIndex::A3)];
+    data1[35] = altitudeData[2] | flagBytes[static_cast<int>(DisplayByteIndex::A2)];
+    data1[36] = altitudeData[1] | flagBytes[static_cast<int>(DisplayByteIndex::A1)];
+    data1[37] = altitudeData[0] | vsData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A0)];
 
     // Add vertical speed data (4 bytes)
-    data1.push_back(vsData[3] | flagBytes[static_cast<int>(DisplayByteIndex::V3)]);
-    data1.push_back(vsData[2] | flagBytes[static_cast<int>(DisplayByteIndex::V2)]);
-    data1.push_back(vsData[1] | flagBytes[static_cast<int>(DisplayByteIndex::V1)]);
-    data1.push_back(vsData[0] | flagBytes[static_cast<int>(DisplayByteIndex::V0)]);
+    data1[38] = vsData[3] | flagBytes[static_cast<int>(DisplayByteIndex::V3)];
+    data1[39] = vsData[2] | flagBytes[static_cast<int>(DisplayByteIndex::V2)];
+    data1[40] = vsData[1] | flagBytes[static_cast<int>(DisplayByteIndex::V1)];
+    data1[41] = vsData[0] | flagBytes[static_cast<int>(DisplayByteIndex::V0)];
 
-    // Pad to 64 bytes
-    while (data1.size() < 64) {
-        data1.push_back(0x00);
-    }
-
-    writeData(data1);
+    // Remaining bytes up to 64 stay zero
+    writeReport(data1, USBWritePriority::Display);
 
     // Second request - commit display data
-    std::vector<uint8_t> data2 = {
+    const std::array<uint8_t, 64> data2 = {
         0xF0, 0x00, packetNumber, 0x11, ProductFCUEfis::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00};
 
-    // Pad to 64 bytes
-    while (data2.size() < 64) {
-        data2.push_back(0x00);
-    }
-
-    writeData(data2);
+    writeReport(data2, USBWritePriority::Display);
 
     packetNumber++;
     if (packetNumber == 0) {
@@ -415,14 +445,14 @@ void ProductFCUEfis::sendFCUDisplay(const std::string &speed, const std::string
 }
 
 void ProductFCUEfis::sendEfisDisplayWithFlags(EfisDisplayValue *data, bool isRightSide) {
-    std::vector<uint8_t> flagBytes(17, 0);
+    std::array<uint8_t, 17> flagBytes = {};
     flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B0 : DisplayByteIndex::EFISL_B0)] |= data->isStd ? 0x00 : (data->showQfe ? 0x01 : 0x02);
     if (data->unitIsInHg) { // Show comma
         flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B2 : DisplayByteIndex::EFISL_B2)] |= 0x80;
     }
 
     // EFIS display protocol
-    std::vector<uint8_t> payload = {
+    std::array<uint8_t, 64> payload = {
         0xF0, 0x00, packetNumber, 0x1A, static_cast<uint8_t>(isRightSide ? 0x0E : 0x0D), 0xBF, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
     // Add barometric data
@@ -433,21 +463,17 @@ void ProductFCUEfis::sendEfisDisplayWithFlags(EfisDisplayValue *data, bool isRig
         std::fill(flagBytes.begin(), flagBytes.end(), 0);
     }
 
-    payload.push_back(baroData[3]);
-    payload.push_back(baroData[2] | flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B2 : DisplayByteIndex::EFISL_B2)]);
-    payload.push_back(baroData[1]);
-    payload.push_back(baroData[0]);
-    payload.push_back(flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B0 : DisplayByteIndex::EFISL_B0)]);
-
-    // Add second command
-    payload.insert(payload.end(), {0x0E, 0xBF, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x4C, 0x0C, 0x1D});
+    payload[25] = baroData[3];
+    payload[26] = baroData[2] | flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B2 : DisplayByteIndex::EFISL_B2)];
+    payload[27] = baroData[1];
+    payload[28] = baroData[0];
+    payload[29] = flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B0 : DisplayByteIndex::EFISL_B0)];
 
-    // Pad to 64 bytes
-    while (payload.size() < 64) {
-        payload.push_back(0x00);
-    }
+    // Add second command, remaining bytes up to 64 stay zero
+    constexpr uint8_t commitCommand[] = {0x0E, 0xBF, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x4C, 0x0C, 0x1D};
+    std::copy(std::begin(commitCommand), std::end(commitCommand), payload.begin() + 30);
 
-    writeData(payload);
+    writeReport(payload, USBWritePriority::Display);
 
     // Increment package number for next call
     packetNumber++;
@@ -457,34 +483,48 @@ void ProductFCUEfis::sendEfisDisplayWithFlags(EfisDisplayValue *data, bool isRig
 }
 
 void ProductFCUEfis::setLedBrightness(FCUEfisLed led, uint8_t brightness) {
-    std::vector<uint8_t> data;
+    std::array<uint8_t, 14> data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x49, 0x00, brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
 
     int ledValue = static_cast<int>(led);
 
     if (ledValue < 100) {
         // FCU LEDs
-        data = {0x02, ProductFCUEfis::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(ledValue), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
+        data[1] = ProductFCUEfis::IdentifierByte;
+        data[2] = 0xBB;
+        data[7] = static_cast<uint8_t>(ledValue);
     } else if (ledValue < 200) {
         // EFIS Right LEDs
-        data = {0x02, 0x0E, 0xBF, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(ledValue - 100), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
+        data[1] = 0x0E;
+        data[2] = 0xBF;
+        data[7] = static_cast<uint8_t>(ledValue - 100);
     } else if (ledValue < 300) {
         // EFIS Left LEDs
-        data = {0x02, 0x0D, 0xBF, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(ledValue - 200), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
-    }
-
-    if (!data.empty()) {
-        writeData(data);
+        data[1] = 0x0D;
+        data[2] = 0xBF;
+        data[7] = static_cast<uint8_t>(ledValue - 200);
     } else {
         debug("No LED data generated for LED %d\n", ledValue);
+        return;
     }
+
+    writeReport(data);
 }
 
-void ProductFCUEfis::forceStateSync() {
+void ProductFCUEfis::resetSwitchState() {
     pressedButtonIndices.clear();
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
 }
 
+void ProductFCUEfis::forceStateSync() {
+    resetSwitchState();
+
+    // Without a profile the report would be dropped anyway
+    if (profile) {
+        requestInputReport(1);
+    }
+}
+
 void ProductFCUEfis::didReceiveData(int reportId, uint8_t *report, int reportLength) {
     if (!connected || !profile || !report || reportLength <= 0) {
         return;
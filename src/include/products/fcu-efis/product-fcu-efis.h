@@ -23,7 +23,7 @@ class ProductFCUEfis : public USBDevice {
         void updateDisplays();
 
     public:
-        ProductFCUEfis(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName);
+        ProductFCUEfis(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity);
         ~ProductFCUEfis();
 
         static constexpr unsigned char IdentifierByte = 0x10;
@@ -32,7 +32,11 @@ class ProductFCUEfis : public USBDevice {
         bool connect() override;
         void disconnect() override;
         void update() override;
+        void unloadProfile() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
+        // Forgets the switch positions, so the next input report sends all of them to the sim again
+        void resetSwitchState();
+        // Also asks the unit for that report now, a blocking query made only with a profile bound
         void forceStateSync();
 
         void setLedBrightness(FCUEfisLed led, uint8_t brightness);
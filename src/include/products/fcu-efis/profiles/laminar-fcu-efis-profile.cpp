@@ -33,125 +33,125 @@ LaminarFCUEfisProfile::LaminarFCUEfisProfile(ProductFCUEfis *product) :
         product->setLedBrightness(FCUEfisLed::EFISR_SCREEN_BACKLIGHT, screenBrightness);
         product->setLedBrightness(FCUEfisLed::EFISL_SCREEN_BACKLIGHT, screenBrightness);
 
-        product->forceStateSync();
-    });
+        product->resetSwitchState();
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/autopilot/ap1_mode", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/autopilot/ap2_mode", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP2_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/autopilot/a_thr_mode", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::ATHR_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/autopilot/loc_mode", [product](bool illuminated) {
         product->setLedBrightness(FCUEfisLed::LOC_GREEN, illuminated ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/autopilot/appr_mode", [product](bool illuminated) {
         product->setLedBrightness(FCUEfisLed::APPR_GREEN, illuminated ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<int>("laminar/A333/annun/autopilot/alt_mode", [product](bool illuminated) {
         product->setLedBrightness(FCUEfisLed::EXPED_GREEN, illuminated ? 1 : 0);
-    });
+    }, this);
 
     // Monitor EFIS Right (Captain) LED states
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/fo_flight_director_on", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::EFISR_FD_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/fo_ls_bars_on", [product](bool on) {
         product->setLedBrightness(FCUEfisLed::EFISR_LS_GREEN, on ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_fo_cstr", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_CSTR_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_fo_fix", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_WPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_fo_vor", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_VORD_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_fo_ndb", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_NDB_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_fo_arpt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_ARPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     // Monitor EFIS Left (First Officer) LED states
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/capt_flight_director_on", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::EFISL_FD_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/captain_ls_bars_on", [product](bool on) {
         product->setLedBrightness(FCUEfisLed::EFISL_LS_GREEN, on ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_capt_cstr", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_CSTR_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_capt_fix", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_WPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_capt_vor", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_VORD_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_capt_ndb", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_NDB_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/A333/annun/EFIS_capt_arpt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_ARPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 }
 
 LaminarFCUEfisProfile::~LaminarFCUEfisProfile() {
-    Dataref::getInstance()->unbind("sim/cockpit2/electrical/instrument_brightness_ratio");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/battery_on");
+    Dataref::getInstance()->unbind("sim/cockpit2/electrical/instrument_brightness_ratio", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/battery_on", this);
 
     // Unbind FCU datarefs
-    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/ap1_mode");
-    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/ap2_mode");
-    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/a_thr_mode");
-    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/loc_mode");
-    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/appr_mode");
-    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/alt_mode");
+    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/ap1_mode", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/ap2_mode", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/a_thr_mode", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/loc_mode", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/appr_mode", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/autopilot/alt_mode", this);
 
     // Unbind EFIS Right datarefs
-    Dataref::getInstance()->unbind("laminar/A333/annun/fo_flight_director_on");
-    Dataref::getInstance()->unbind("laminar/A333/annun/fo_ls_bars_on");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_cstr");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_fix");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_vor");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_ndb");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_arpt");
+    Dataref::getInstance()->unbind("laminar/A333/annun/fo_flight_director_on", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/fo_ls_bars_on", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_cstr", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_fix", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_vor", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_ndb", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_fo_arpt", this);
 
     // Unbind EFIS Left datarefs
-    Dataref::getInstance()->unbind("laminar/A333/annun/capt_flight_director_on");
-    Dataref::getInstance()->unbind("laminar/A333/annun/captain_ls_bars_on");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_cstr");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_fix");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_vor");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_ndb");
-    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_arpt");
+    Dataref::getInstance()->unbind("laminar/A333/annun/capt_flight_director_on", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/captain_ls_bars_on", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_cstr", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_fix", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_vor", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_ndb", this);
+    Dataref::getInstance()->unbind("laminar/A333/annun/EFIS_capt_arpt", this);
 }
 
 bool LaminarFCUEfisProfile::IsEligible() {
@@ -34,126 +34,126 @@ TolissFCUEfisProfile::TolissFCUEfisProfile(ProductFCUEfis *product) :
         product->setLedBrightness(FCUEfisLed::EFISR_SCREEN_BACKLIGHT, screenBrightness);
         product->setLedBrightness(FCUEfisLed::EFISL_SCREEN_BACKLIGHT, screenBrightness);
 
-        product->forceStateSync();
-    });
+        product->resetSwitchState();
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FCUAvail", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/SupplLightLevelRehostats");
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/AP1Engage", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/AP2Engage", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP2_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<int>("AirbusFBW/ATHRmode", [product](int mode) {
         product->setLedBrightness(FCUEfisLed::ATHR_GREEN, mode > 0 ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/LOCilluminated", [product](bool illuminated) {
         product->setLedBrightness(FCUEfisLed::LOC_GREEN, illuminated ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/APPRilluminated", [product](bool illuminated) {
         product->setLedBrightness(FCUEfisLed::APPR_GREEN, illuminated ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<int>("AirbusFBW/APVerticalMode", [product](int vsMode) {
         bool expedEnabled = vsMode >= 0 && vsMode & 0b00010000;
         product->setLedBrightness(FCUEfisLed::EXPED_GREEN, expedEnabled ? 1 : 0);
-    });
+    }, this);
 
     // Monitor EFIS Right (Captain) LED states
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FD2Engage", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::EFISR_FD_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/ILSonFO", [product](bool on) {
         product->setLedBrightness(FCUEfisLed::EFISR_LS_GREEN, on ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowCSTRFO", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_CSTR_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowWPTFO", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_WPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowVORDFO", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_VORD_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowNDBFO", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_NDB_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowARPTFO", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISR_ARPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     // Monitor EFIS Left (First Officer) LED states
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FD1Engage", [product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::EFISL_FD_GREEN, engaged ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/ILSonCapt", [product](bool on) {
         product->setLedBrightness(FCUEfisLed::EFISL_LS_GREEN, on ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowCSTRCapt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_CSTR_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowWPTCapt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_WPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowVORDCapt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_VORD_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowNDBCapt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_NDB_GREEN, show ? 1 : 0);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/NDShowARPTCapt", [product](bool show) {
         product->setLedBrightness(FCUEfisLed::EFISL_ARPT_GREEN, show ? 1 : 0);
-    });
+    }, this);
 }
 
 TolissFCUEfisProfile::~TolissFCUEfisProfile() {
-    Dataref::getInstance()->unbind("AirbusFBW/SupplLightLevelRehostats");
-    Dataref::getInstance()->unbind("AirbusFBW/FCUAvail");
+    Dataref::getInstance()->unbind("AirbusFBW/SupplLightLevelRehostats", this);
+    Dataref::getInstance()->unbind("AirbusFBW/FCUAvail", this);
 
     // Unbind FCU datarefs
-    Dataref::getInstance()->unbind("AirbusFBW/AP1Engage");
-    Dataref::getInstance()->unbind("AirbusFBW/AP2Engage");
-    Dataref::getInstance()->unbind("AirbusFBW/ATHRmode");
-    Dataref::getInstance()->unbind("AirbusFBW/LOCilluminated");
-    Dataref::getInstance()->unbind("AirbusFBW/APPRilluminated");
-    Dataref::getInstance()->unbind("AirbusFBW/APVerticalMode");
+    Dataref::getInstance()->unbind("AirbusFBW/AP1Engage", this);
+    Dataref::getInstance()->unbind("AirbusFBW/AP2Engage", this);
+    Dataref::getInstance()->unbind("AirbusFBW/ATHRmode", this);
+    Dataref::getInstance()->unbind("AirbusFBW/LOCilluminated", this);
+    Dataref::getInstance()->unbind("AirbusFBW/APPRilluminated", this);
+    Dataref::getInstance()->unbind("AirbusFBW/APVerticalMode", this);
 
     // Unbind EFIS Right datarefs
-    Dataref::getInstance()->unbind("AirbusFBW/FD2Engage");
-    Dataref::getInstance()->unbind("AirbusFBW/ILSonFO");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowCSTRFO");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowWPTFO");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowVORDFO");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowNDBFO");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowARPTFO");
+    Dataref::getInstance()->unbind("AirbusFBW/FD2Engage", this);
+    Dataref::getInstance()->unbind("AirbusFBW/ILSonFO", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowCSTRFO", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowWPTFO", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowVORDFO", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowNDBFO", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowARPTFO", this);
 
     // Unbind EFIS Left datarefs
-    Dataref::getInstance()->unbind("AirbusFBW/FD1Engage");
-    Dataref::getInstance()->unbind("AirbusFBW/ILSonCapt");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowCSTRCapt");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowWPTCapt");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowVORDCapt");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowNDBCapt");
-    Dataref::getInstance()->unbind("AirbusFBW/NDShowARPTCapt");
+    Dataref::getInstance()->unbind("AirbusFBW/FD1Engage", this);
+    Dataref::getInstance()->unbind("AirbusFBW/ILSonCapt", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowCSTRCapt", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowWPTCapt", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowVORDCapt", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowNDBCapt", this);
+    Dataref::getInstance()->unbind("AirbusFBW/NDShowARPTCapt", this);
 }
 
 bool TolissFCUEfisProfile::IsEligible() {
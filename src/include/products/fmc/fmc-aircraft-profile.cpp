@@ -0,0 +1,50 @@
+#include "fmc-aircraft-profile.h"
+
+#include "dataref.h"
+#include "product-fmc.h"
+
+namespace {
+    std::string swapToken(std::string name, std::string_view from, std::string_view to) {
+        size_t position = name.find(from);
+        if (position != std::string::npos) {
+            name.replace(position, from.length(), to);
+        }
+        return name;
+    }
+}
+
+void FMCAircraftProfile::followUnitSide() {
+    side = product->side == FMCSide::FirstOfficer ? FMCSide::FirstOfficer : FMCSide::Captain;
+}
+
+std::vector<std::string> FMCAircraftProfile::forSide(const std::vector<std::string> &captainNames, std::string_view captainToken, std::string_view firstOfficerToken) const {
+    if (side != FMCSide::FirstOfficer) {
+        return captainNames;
+    }
+
+    std::vector<std::string> names;
+    names.reserve(captainNames.size());
+    for (const std::string &name : captainNames) {
+        names.push_back(swapToken(name, captainToken, firstOfficerToken));
+    }
+    return names;
+}
+
+std::vector<FMCButtonDef> FMCAircraftProfile::forSide(const std::vector<FMCButtonDef> &captainDefs, std::string_view captainToken, std::string_view firstOfficerToken) const {
+    std::vector<FMCButtonDef> defs = captainDefs;
+    if (side != FMCSide::FirstOfficer) {
+        return defs;
+    }
+
+    for (FMCButtonDef &def : defs) {
+        def.dataref = swapToken(def.dataref, captainToken, firstOfficerToken);
+    }
+    return defs;
+}
+
+std::string FMCAircraftProfile::forSide(const std::string &captainName, const std::string &firstOfficerName) const {
+    if (side != FMCSide::FirstOfficer || !Dataref::getInstance()->exists(firstOfficerName.c_str())) {
+        return captainName;
+    }
+    return firstOfficerName;
+}
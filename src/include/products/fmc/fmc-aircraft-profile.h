@@ -2,10 +2,13 @@
 #define FMC_AIRCRAFT_PROFILE_H
 
 #include "fmc-hardware-mapping.h"
+#include "fmc-packetizer.h"
+#include "fmc-screen.h"
 
 #include <array>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <XPLMUtilities.h>
 
@@ -85,22 +88,76 @@ enum class FMCBackgroundVariant : unsigned char {
     WINWING_LOGO
 };
 
+enum class FMCDisplayBindingKind : unsigned char {
+    Title,
+    Label,
+    Content,
+    Scratchpad,
+};
+
+// What a display dataref feeds, worked out from its name once when the profile is created
+// so rendering only has to walk the bindings and their cached text.
+struct FMCDisplayBinding {
+        const char *ref; // Points into the profile's displayDatarefs()
+        FMCDisplayBindingKind kind;
+        unsigned char row;
+        char color;
+        bool fontSmall;
+};
+
 class ProductFMC;
 
 class FMCAircraftProfile {
     protected:
         ProductFMC *product;
+        FMCSide side = FMCSide::Captain; // The CDU shown, which the profile's datarefs and commands are for
+        std::vector<FMCDisplayBinding> displayBindings; // Left empty by profiles that render without them
+
+        // For profiles that know the first officer's CDU: show the side the unit is built for,
+        // the observer's unit gets the captain's
+        void followUnitSide();
+
+        // The captain's names with captainToken swapped for firstOfficerToken when showing the first officer's side
+        std::vector<std::string> forSide(const std::vector<std::string> &captainNames, std::string_view captainToken, std::string_view firstOfficerToken) const;
+        std::vector<FMCButtonDef> forSide(const std::vector<FMCButtonDef> &captainDefs, std::string_view captainToken, std::string_view firstOfficerToken) const;
+        // The first officer's dataref when showing that side and the aircraft publishes it, the captain's otherwise
+        std::string forSide(const std::string &captainName, const std::string &firstOfficerName) const;
 
     public:
         FMCAircraftProfile(ProductFMC *product) :
             product(product) {};
         virtual ~FMCAircraftProfile() = default;
 
+        FMCSide displayedSide() const {
+            return side;
+        }
+
         virtual const std::vector<std::string> &displayDatarefs() const = 0;
         virtual const std::vector<FMCButtonDef> &buttonDefs() const = 0;
         virtual const std::map<char, FMCTextColor> &colorMap() const = 0;
-        virtual void mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) = 0;
-        virtual void updatePage(std::vector<std::vector<char>> &page) = 0;
+        virtual void mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) = 0;
+        // Renders into a screen that starts out blank
+        virtual void updatePage(FMCScreen &screen) = 0;
+
+        // The lines a display dataref feeds. Without display bindings every change redraws the page.
+        virtual FMCRowMask displayRowsForDataref(const std::string &ref) const {
+            if (displayBindings.empty()) {
+                return FMCScreen::AllRows;
+            }
+
+            FMCRowMask rows = 0;
+            for (const auto &binding : displayBindings) {
+                if (ref == binding.ref) {
+                    rows |= FMCScreen::rowMask(binding.row);
+                }
+            }
+            return rows;
+        }
+
+        // Re-renders the given lines, which have been blanked; the rest of screen is up to date
+        virtual void updateRows(FMCScreen &screen, FMCRowMask rows) {
+            updatePage(screen);
+        }
         virtual void buttonPressed(const FMCButtonDef *button, XPLMCommandPhase phase) = 0;
 };
 
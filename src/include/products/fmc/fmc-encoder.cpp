@@ -0,0 +1,74 @@
+#include "fmc-encoder.h"
+
+#include "appstate.h"
+#include "config.h"
+#include "fmc-aircraft-profile.h"
+
+#include <algorithm>
+#include <XPLMUtilities.h>
+
+FMCEncoder::FMCEncoder() {
+    for (auto &bytes : rowBytes) {
+        bytes.fill(0);
+    }
+    rowLengths.fill(0);
+    staleRows = FMCScreen::AllRows;
+}
+
+void FMCEncoder::compile(FMCAircraftProfile *profile) {
+    const std::map<char, FMCTextColor> &colorMap = profile->colorMap();
+    FMCPacketizer scratch;
+
+    for (int fontSmall = 0; fontSmall < 2; ++fontSmall) {
+        for (int value = 0; value < 256; ++value) {
+            auto it = colorMap.find(static_cast<char>(value));
+            int color = it != colorMap.end() ? it->second : FMCTextColor::COLOR_WHITE;
+            if (fontSmall) {
+                color += 0x016b;
+            }
+            colors[fontSmall][value] = static_cast<uint16_t>(color);
+
+            scratch.begin();
+            profile->mapCharacter(&scratch, static_cast<uint8_t>(value), fontSmall);
+            Glyph &glyph = glyphs[fontSmall][value];
+            glyph = {};
+            glyph.length = static_cast<uint8_t>(std::min<size_t>(scratch.size(), sizeof(glyph.bytes)));
+            if (scratch.size() > sizeof(glyph.bytes)) {
+                debug("Glyph 0x%02X maps to %zu bytes, keeping the first %zu\n", value, scratch.size(), sizeof(glyph.bytes));
+            }
+            std::copy_n(scratch.reports().begin() + 1, glyph.length, glyph.bytes);
+        }
+    }
+
+    staleRows = FMCScreen::AllRows;
+}
+
+void FMCEncoder::encode(const FMCScreen &screen, FMCRowMask rows, FMCPacketizer &packetizer) {
+    rows |= staleRows;
+    staleRows = 0;
+
+    packetizer.begin();
+    for (unsigned int line = 0; line < FMCScreen::Lines; ++line) {
+        if (rows & FMCScreen::rowMask(line)) {
+            encodeRow(screen, line);
+        }
+        packetizer.append({rowBytes[line].data(), rowLengths[line]});
+    }
+    packetizer.finish();
+}
+
+void FMCEncoder::encodeRow(const FMCScreen &screen, int line) {
+    uint8_t *out = rowBytes[line].data();
+    for (const FMCCell &cell : screen.row(line)) {
+        uint16_t color = colors[cell.fontSmall][static_cast<uint8_t>(cell.color)];
+        const Glyph &glyph = glyphs[cell.fontSmall][static_cast<uint8_t>(cell.glyph)];
+
+        out[0] = static_cast<uint8_t>(color & 0xFF);
+        out[1] = static_cast<uint8_t>(color >> 8);
+        out[2] = glyph.bytes[0];
+        out[3] = glyph.bytes[1];
+        out[4] = glyph.bytes[2];
+        out += 2 + glyph.length;
+    }
+    rowLengths[line] = out - rowBytes[line].data();
+}
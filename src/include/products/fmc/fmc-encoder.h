@@ -0,0 +1,45 @@
+#ifndef FMC_ENCODER_H
+#define FMC_ENCODER_H
+
+#include "fmc-packetizer.h"
+#include "fmc-screen.h"
+
+#include <array>
+#include <cstdint>
+
+class FMCAircraftProfile;
+
+// A profile's colorMap() and mapCharacter() flattened into lookup tables by font size and
+// byte value, compiled once when the profile is bound. Encoding a frame is then a plain loop
+// over the cells with no virtual calls or map lookups: every cell becomes its 2 color bytes
+// and 0 to 3 glyph bytes. The encoded lines are kept, so only the ones that changed since the
+// last frame are encoded again.
+class FMCEncoder {
+    public:
+        FMCEncoder();
+
+        void compile(FMCAircraftProfile *profile);
+
+        // rows are the lines of screen that differ from the previously encoded one
+        void encode(const FMCScreen &screen, FMCRowMask rows, FMCPacketizer &packetizer);
+
+    private:
+        struct Glyph {
+                uint8_t bytes[3];
+                uint8_t length;
+        };
+
+        std::array<std::array<uint16_t, 256>, 2> colors; // [fontSmall][color]
+        std::array<std::array<Glyph, 256>, 2> glyphs;    // [fontSmall][glyph]
+
+        // Every cell is written at its full 5 byte width and the cursor advanced by what it took,
+        // which keeps the loop free of per-glyph branches
+        static constexpr size_t MaxRowBytes = FMCPacketizer::MaxFrameBytes / FMCScreen::Lines;
+        std::array<std::array<uint8_t, MaxRowBytes>, FMCScreen::Lines> rowBytes;
+        std::array<size_t, FMCScreen::Lines> rowLengths;
+        FMCRowMask staleRows; // Not encoded with the current tables yet
+
+        void encodeRow(const FMCScreen &screen, int line);
+};
+
+#endif
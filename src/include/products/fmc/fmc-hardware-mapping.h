@@ -12,6 +12,13 @@ enum class FMCHardwareType : unsigned char {
     HARDWARE_PFP7,
 };
 
+// Which seat a unit is built for
+enum class FMCSide : unsigned char {
+    Captain = 1,
+    FirstOfficer,
+    Observer,
+};
+
 enum class FMCKey : unsigned char {
     LSK1L = 1,
     LSK1R,
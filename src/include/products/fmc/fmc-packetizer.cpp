@@ -0,0 +1,65 @@
+#include "fmc-packetizer.h"
+
+#include <algorithm>
+
+FMCPacketizer::FMCPacketizer() {
+    buffer.fill(0);
+    for (size_t offset = 0; offset < buffer.size(); offset += ReportLength) {
+        buffer[offset] = ReportId;
+    }
+    begin();
+}
+
+void FMCPacketizer::begin() {
+    cursor = 1;
+    reportEnd = ReportLength;
+    overflow = false;
+}
+
+bool FMCPacketizer::nextReport() {
+    if (reportEnd == buffer.size()) {
+        overflow = true;
+        return false;
+    }
+
+    cursor += 1; // Past the next report's ID
+    reportEnd += ReportLength;
+    return true;
+}
+
+void FMCPacketizer::append(std::span<const uint8_t> bytes) {
+    while (!bytes.empty()) {
+        if (cursor == reportEnd && !nextReport()) {
+            return;
+        }
+
+        size_t run = std::min(bytes.size(), reportEnd - cursor);
+        std::copy_n(bytes.begin(), run, buffer.begin() + cursor);
+        cursor += run;
+        bytes = bytes.subspan(run);
+    }
+}
+
+void FMCPacketizer::finish() {
+    std::fill(buffer.begin() + cursor, buffer.begin() + reportEnd, 0);
+}
+
+size_t FMCPacketizer::size() const {
+    return (reportEnd / ReportLength - 1) * PayloadPerReport + cursor - (reportEnd - ReportLength) - 1;
+}
+
+size_t FMCPacketizer::reportCount() const {
+    return cursor == 1 ? 0 : reportEnd / ReportLength;
+}
+
+std::span<const uint8_t> FMCPacketizer::report(size_t index) const {
+    return std::span<const uint8_t>(buffer).subspan(index * ReportLength, ReportLength);
+}
+
+std::span<const uint8_t> FMCPacketizer::reports() const {
+    return std::span<const uint8_t>(buffer).first(reportCount() * ReportLength);
+}
+
+bool FMCPacketizer::overflowed() const {
+    return overflow;
+}
@@ -0,0 +1,54 @@
+#ifndef FMC_PACKETIZER_H
+#define FMC_PACKETIZER_H
+
+#include "fmc-screen.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Lays an encoded display frame out as the 0xf2 reports the hardware takes, while it is being
+// encoded: every report is 64 bytes, the report ID followed by 63 bytes of the cell stream, the
+// last one zero padded. Sized for the worst case frame, so encoding never allocates.
+class FMCPacketizer {
+    public:
+        static constexpr size_t ReportLength = 64;
+        static constexpr size_t PayloadPerReport = ReportLength - 1;
+        static constexpr uint8_t ReportId = 0xf2;
+
+        // Every cell is a color pair plus at most a 3 byte UTF-8 glyph
+        static constexpr size_t MaxFrameBytes = FMCScreen::Lines * FMCScreen::CharsPerLine * 5;
+        static constexpr size_t MaxReports = (MaxFrameBytes + PayloadPerReport - 1) / PayloadPerReport;
+
+        FMCPacketizer();
+
+        void begin();
+
+        // Called for every byte of every frame, so the common case is kept inline
+        void push_back(uint8_t byte) {
+            if (cursor == reportEnd && !nextReport()) {
+                return;
+            }
+            buffer[cursor++] = byte;
+        }
+
+        void append(std::span<const uint8_t> bytes);
+        void finish();
+
+        size_t size() const; // Payload bytes so far
+        size_t reportCount() const;
+        std::span<const uint8_t> report(size_t index) const;
+        std::span<const uint8_t> reports() const; // All of them back to back
+        bool overflowed() const;
+
+    private:
+        std::array<uint8_t, MaxReports * ReportLength> buffer;
+        size_t cursor;
+        size_t reportEnd;
+        bool overflow;
+
+        bool nextReport();
+};
+
+#endif
@@ -0,0 +1,71 @@
+#include "fmc-screen.h"
+
+#include "appstate.h"
+#include "config.h"
+
+#include <algorithm>
+#include <cstring>
+#include <XPLMUtilities.h>
+
+FMCScreen::FMCScreen() {
+    clear();
+}
+
+void FMCScreen::clear() {
+    grid.fill(BlankCell);
+}
+
+void FMCScreen::clearRows(FMCRowMask rows) {
+    for (unsigned int line = 0; line < Lines; ++line) {
+        if (rows & rowMask(line)) {
+            std::fill_n(grid.begin() + line * CharsPerLine, CharsPerLine, BlankCell);
+        }
+    }
+}
+
+void FMCScreen::putChar(int line, int pos, char glyph, char color, bool fontSmall, uint8_t effect) {
+    if (line < 0 || line >= (int) Lines || pos < 0 || pos >= (int) CharsPerLine) {
+        return;
+    }
+
+    grid[line * CharsPerLine + pos] = {glyph, color, fontSmall, effect};
+}
+
+bool FMCScreen::putText(int line, int pos, std::string_view text, char color, bool fontSmall) {
+    if (line < 0 || line >= (int) Lines) {
+        debug("Not writing line %i: Line number is out of range!\n", line);
+        return false;
+    }
+    if (pos < 0 || pos + text.length() > CharsPerLine) {
+        debug("Not writing line %i: Position number (%i) is out of range!\n", line, pos);
+        return false;
+    }
+
+    for (size_t c = 0; c < text.length(); ++c) {
+        grid[line * CharsPerLine + pos + c] = {text[c], color, fontSmall, 0};
+    }
+    return true;
+}
+
+const FMCCell &FMCScreen::cell(int line, int pos) const {
+    return grid[line * CharsPerLine + pos];
+}
+
+std::span<const FMCCell> FMCScreen::cells() const {
+    return grid;
+}
+
+std::span<const FMCCell> FMCScreen::row(int line) const {
+    return std::span<const FMCCell>(grid).subspan(line * CharsPerLine, CharsPerLine);
+}
+
+FMCRowMask FMCScreen::rowsDifferingFrom(const FMCScreen &other) const {
+    FMCRowMask rows = 0;
+    for (unsigned int line = 0; line < Lines; ++line) {
+        // FMCCell has no padding, so lines compare as plain bytes
+        if (std::memcmp(&grid[line * CharsPerLine], &other.grid[line * CharsPerLine], CharsPerLine * sizeof(FMCCell)) != 0) {
+            rows |= rowMask(line);
+        }
+    }
+    return rows;
+}
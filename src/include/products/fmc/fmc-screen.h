@@ -0,0 +1,58 @@
+#ifndef FMC_SCREEN_H
+#define FMC_SCREEN_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+// One character position. color is a key into the profile's colorMap().
+struct FMCCell {
+        char glyph;
+        char color;
+        bool fontSmall;
+        uint8_t effect; // As reported by the aircraft (inverted, boxed, ...), 0 for none
+
+        bool operator==(const FMCCell &other) const = default;
+};
+
+static_assert(sizeof(FMCCell) == 4, "FMCCell is meant to stay packed");
+
+// A set of screen lines, bit n standing for line n
+using FMCRowMask = uint16_t;
+
+// The 14 x 24 character display (header, 6 label and 6 content lines, scratchpad) as one
+// flat array, so rendering into it never allocates.
+class FMCScreen {
+    public:
+        static constexpr unsigned int Lines = 14;
+        static constexpr unsigned int CharsPerLine = 24;
+        static constexpr FMCRowMask AllRows = (1 << Lines) - 1;
+
+        static constexpr FMCRowMask rowMask(unsigned int line) {
+            return line < Lines ? 1 << line : 0;
+        }
+
+        // What an untouched position encodes to; matches the space-filled pages profiles used to start from
+        static constexpr FMCCell BlankCell = {' ', ' ', true, 0};
+
+        FMCScreen();
+
+        void clear();
+        void clearRows(FMCRowMask rows);
+
+        // Positions outside the screen are ignored, profiles routinely run past the end of a line
+        void putChar(int line, int pos, char glyph, char color, bool fontSmall = false, uint8_t effect = 0);
+        bool putText(int line, int pos, std::string_view text, char color, bool fontSmall = false);
+
+        const FMCCell &cell(int line, int pos) const;
+        std::span<const FMCCell> cells() const; // Row by row, the order the display takes them in
+        std::span<const FMCCell> row(int line) const;
+        FMCRowMask rowsDifferingFrom(const FMCScreen &other) const;
+        bool operator==(const FMCScreen &other) const = default;
+
+    private:
+        std::array<FMCCell, Lines * CharsPerLine> grid;
+};
+
+#endif
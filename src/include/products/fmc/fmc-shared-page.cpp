@@ -0,0 +1,89 @@
+#include "fmc-shared-page.h"
+
+#include "dataref.h"
+#include "fmc-aircraft-profile.h"
+
+#include <map>
+#include <typeindex>
+#include <XPLMProcessing.h>
+
+namespace {
+    std::map<std::pair<std::type_index, FMCSide>, std::weak_ptr<FMCSharedPage>> sharedPages;
+}
+
+FMCSharedPage::FMCSharedPage(FMCAircraftProfile *profile) {
+    for (const std::string &dataref : profile->displayDatarefs()) {
+        displayDatarefRows.push_back(profile->displayRowsForDataref(dataref));
+    }
+
+    pendingRows = 0;
+    lastUpdateCycle = 0;
+    lastPollCycle = 0;
+    renderCount = 0;
+}
+
+std::shared_ptr<FMCSharedPage> FMCSharedPage::acquire(FMCAircraftProfile *profile) {
+    std::erase_if(sharedPages, [](const auto &entry) {
+        return entry.second.expired();
+    });
+
+    auto key = std::make_pair(std::type_index(typeid(*profile)), profile->displayedSide());
+    if (auto page = sharedPages[key].lock()) {
+        return page;
+    }
+
+    auto page = std::make_shared<FMCSharedPage>(profile);
+    sharedPages[key] = page;
+    return page;
+}
+
+void FMCSharedPage::poll(FMCAircraftProfile *profile) {
+    int cycle = XPLMGetCycleNumber();
+    if (lastPollCycle && cycle == lastPollCycle) {
+        return;
+    }
+    lastPollCycle = cycle;
+
+    if (!lastUpdateCycle) {
+        pendingRows = FMCScreen::AllRows;
+        lastUpdateCycle = cycle;
+        return;
+    }
+
+    auto datarefManager = Dataref::getInstance();
+    const std::vector<std::string> &datarefs = profile->displayDatarefs();
+    bool changed = false;
+    for (size_t i = 0; i < datarefs.size() && i < displayDatarefRows.size(); ++i) {
+        if (datarefManager->getCachedLastUpdate(datarefs[i].c_str()) > lastUpdateCycle) {
+            pendingRows |= displayDatarefRows[i];
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        lastUpdateCycle = cycle;
+    }
+}
+
+void FMCSharedPage::render(FMCAircraftProfile *profile) {
+    if (!pendingRows) {
+        return;
+    }
+
+    page.clearRows(pendingRows);
+    profile->updateRows(page, pendingRows);
+    pendingRows = 0;
+    renderCount++;
+}
+
+bool FMCSharedPage::hasPendingRows() const {
+    return pendingRows != 0;
+}
+
+uint64_t FMCSharedPage::revision() const {
+    return renderCount;
+}
+
+const FMCScreen &FMCSharedPage::screen() const {
+    return page;
+}
@@ -0,0 +1,40 @@
+#ifndef FMC_SHARED_PAGE_H
+#define FMC_SHARED_PAGE_H
+
+#include "fmc-screen.h"
+#include "fmc-hardware-mapping.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class FMCAircraftProfile;
+
+// The page shown on one side of the cockpit. Every unit showing that side with the same
+// aircraft profile holds the same instance, so the side's datarefs are checked and its
+// page rendered once per cycle however many units display it.
+class FMCSharedPage {
+    public:
+        FMCSharedPage(FMCAircraftProfile *profile);
+
+        static std::shared_ptr<FMCSharedPage> acquire(FMCAircraftProfile *profile);
+
+        // Collects the lines whose display datarefs changed, once per cycle
+        void poll(FMCAircraftProfile *profile);
+        // Re-renders the collected lines, if any
+        void render(FMCAircraftProfile *profile);
+
+        bool hasPendingRows() const;
+        uint64_t revision() const; // Goes up with every render
+        const FMCScreen &screen() const;
+
+    private:
+        FMCScreen page;
+        std::vector<FMCRowMask> displayDatarefRows; // The lines each of the profile's displayDatarefs() feeds
+        FMCRowMask pendingRows;
+        int lastUpdateCycle;
+        int lastPollCycle;
+        uint64_t renderCount;
+};
+
+#endif
@@ -9,53 +9,149 @@
 #include "vga_4.h"
 #include "xcrafts.h"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 
-const std::vector<std::vector<unsigned char>> Font::GlyphData(FontVariant variant, unsigned char hardwareIdentifier) {
-    std::vector<std::vector<unsigned char>> result = {};
+namespace {
+    // Sniffed packets always have the MCDU identifier
+    constexpr uint8_t SniffedIdentifier = 0x32;
+    constexpr uint8_t IdentifierSuffix = 0xbb;
 
-    switch (variant) {
-        case FontVariant::FontAirbus:
-            result = fmcFontAirbus;
-            break;
+    consteval size_t countIdentifiers(std::span<const uint8_t> bytes, std::span<const uint8_t> packetLengths) {
+        size_t count = 0;
+        size_t start = 0;
+        for (uint8_t length : packetLengths) {
+            for (size_t i = start; i + 1 < start + length; ++i) {
+                if (bytes[i] == SniffedIdentifier && bytes[i + 1] == IdentifierSuffix) {
+                    ++count;
+                }
+            }
+            start += length;
+        }
+        return count;
+    }
+
+    template<size_t Count>
+    consteval std::array<uint32_t, Count> findIdentifiers(std::span<const uint8_t> bytes, std::span<const uint8_t> packetLengths) {
+        std::array<uint32_t, Count> offsets = {};
+        size_t count = 0;
+        size_t start = 0;
+        for (uint8_t length : packetLengths) {
+            for (size_t i = start; i + 1 < start + length; ++i) {
+                if (bytes[i] == SniffedIdentifier && bytes[i + 1] == IdentifierSuffix) {
+                    offsets[count++] = static_cast<uint32_t>(i);
+                }
+            }
+            start += length;
+        }
+        return offsets;
+    }
 
-        case FontVariant::Font737:
-            result = fmcFont737;
-            break;
+    // Where the identifier sits in a font's bytes, worked out by the compiler
+    template<const auto &Bytes, const auto &PacketLengths>
+    constexpr auto identifierOffsets = findIdentifiers<countIdentifiers(Bytes, PacketLengths)>(Bytes, PacketLengths);
 
-        case FontVariant::FontXCrafts:
-            result = fmcFontXCrafts;
-            break;
+    // FNV-1a over the unpatched packets and their lengths
+    consteval uint64_t contentHash(std::span<const uint8_t> bytes, std::span<const uint8_t> packetLengths) {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        size_t start = 0;
+        for (uint8_t length : packetLengths) {
+            for (size_t i = start; i < start + length; ++i) {
+                hash ^= bytes[i];
+                hash *= 0x100000001b3ULL;
+            }
+            hash ^= length;
+            hash *= 0x100000001b3ULL;
+            start += length;
+        }
+        return hash;
+    }
 
-        case FontVariant::FontVGA1:
-            result = fmcFontVGA1;
-            break;
+    struct FontTable {
+            std::span<const uint8_t> bytes;
+            std::span<const uint8_t> packetLengths;
+            std::span<const uint32_t> identifierOffsets;
+            uint64_t contentHash;
+    };
 
-        case FontVariant::FontVGA2:
-            result = fmcFontVGA2;
-            break;
+    consteval size_t totalLength(std::span<const uint8_t> packetLengths) {
+        size_t total = 0;
+        for (uint8_t length : packetLengths) {
+            total += length;
+        }
+        return total;
+    }
+
+    template<const auto &Bytes, const auto &PacketLengths>
+    constexpr FontTable makeTable() {
+        static_assert(totalLength(PacketLengths) == Bytes.size(), "Packet lengths don't add up to the font's size");
+        constexpr uint64_t hash = contentHash(Bytes, PacketLengths);
+        return {Bytes, PacketLengths, identifierOffsets<Bytes, PacketLengths>, hash};
+    }
 
-        case FontVariant::FontVGA3:
-            result = fmcFontVGA3;
-            break;
+    const FontTable &fontTable(FontVariant variant) {
+        static constexpr FontTable airbus = makeTable<fmcFontAirbus, fmcFontAirbusPacketLengths>();
+        static constexpr FontTable b737 = makeTable<fmcFont737, fmcFont737PacketLengths>();
+        static constexpr FontTable xcrafts = makeTable<fmcFontXCrafts, fmcFontXCraftsPacketLengths>();
+        static constexpr FontTable vga1 = makeTable<fmcFontVGA1, fmcFontVGA1PacketLengths>();
+        static constexpr FontTable vga2 = makeTable<fmcFontVGA2, fmcFontVGA2PacketLengths>();
+        static constexpr FontTable vga3 = makeTable<fmcFontVGA3, fmcFontVGA3PacketLengths>();
+        static constexpr FontTable vga4 = makeTable<fmcFontVGA4, fmcFontVGA4PacketLengths>();
+        static constexpr FontTable defaultFont = makeTable<fmcFontDefault, fmcFontDefaultPacketLengths>();
 
-        case FontVariant::FontVGA4:
-            result = fmcFontVGA4;
-            break;
+        switch (variant) {
+            case FontVariant::FontAirbus:
+                return airbus;
 
-        case FontVariant::Default:
-        default:
-            result = fmcFontDefault;
-            break;
+            case FontVariant::Font737:
+                return b737;
+
+            case FontVariant::FontXCrafts:
+                return xcrafts;
+
+            case FontVariant::FontVGA1:
+                return vga1;
+
+            case FontVariant::FontVGA2:
+                return vga2;
+
+            case FontVariant::FontVGA3:
+                return vga3;
+
+            case FontVariant::FontVGA4:
+                return vga4;
+
+            case FontVariant::Default:
+            default:
+                return defaultFont;
+        }
     }
+}
+
+void Font::ForEachPacket(FontVariant variant, unsigned char hardwareIdentifier, const std::function<void(std::span<const uint8_t>)> &callback) {
+    const FontTable &table = fontTable(variant);
+    auto identifier = table.identifierOffsets.begin();
+    std::array<uint8_t, 256> patched; // Packet lengths are bytes
+
+    size_t start = 0;
+    for (uint8_t length : table.packetLengths) {
+        std::span<const uint8_t> packet = table.bytes.subspan(start, length);
+        size_t end = start + length;
 
-    for (auto &row : result) {
-        for (size_t i = 0; i + 1 < row.size(); i++) {
-            if (row[i] == 0x32 && row[i + 1] == 0xbb) { // Sniffed packets always have the MCDU identifier
-                row[i] = hardwareIdentifier;
-                row[i + 1] = 0xbb;
+        if (hardwareIdentifier != SniffedIdentifier && identifier != table.identifierOffsets.end() && *identifier < end) {
+            std::copy(packet.begin(), packet.end(), patched.begin());
+            for (; identifier != table.identifierOffsets.end() && *identifier < end; ++identifier) {
+                patched[*identifier - start] = hardwareIdentifier;
             }
+            packet = std::span<const uint8_t>(patched.data(), length);
         }
+
+        callback(packet);
+        start = end;
     }
-    return result;
+}
+
+uint64_t Font::ContentHash(FontVariant variant) {
+    return fontTable(variant).contentHash;
 }
@@ -1,7 +1,9 @@
 #ifndef FONT_H
 #define FONT_H
 
-#include <vector>
+#include <cstdint>
+#include <functional>
+#include <span>
 
 enum class FontVariant : unsigned char {
     Default,
@@ -16,7 +18,10 @@ enum class FontVariant : unsigned char {
 
 class Font {
     public:
-        static const std::vector<std::vector<unsigned char>> GlyphData(FontVariant variant, unsigned char hardwareIdentifier);
+        // Hands out the variant's upload packets in order, straight from the compiled-in tables.
+        // Only the packets carrying the identifier are copied, to put hardwareIdentifier in.
+        static void ForEachPacket(FontVariant variant, unsigned char hardwareIdentifier, const std::function<void(std::span<const uint8_t>)> &callback);
+        static uint64_t ContentHash(FontVariant variant);
 };
 
 #endif
@@ -12,24 +12,33 @@
 #include "profiles/xcrafts-fmc-profile.h"
 #include "profiles/zibo-fmc-profile.h"
 
+#include <algorithm>
 #include <chrono>
 #include <XPLMProcessing.h>
 
-ProductFMC::ProductFMC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, FMCHardwareType hardwareType, unsigned char identifierByte) :
-    USBDevice(hidDevice, vendorId, productId, vendorName, productName), hardwareType(hardwareType), identifierByte(identifierByte) {
+ProductFMC::ProductFMC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, FMCHardwareType hardwareType, FMCSide side, unsigned char identifierByte, std::string identity) :
+    USBDevice(hidDevice, vendorId, productId, vendorName, productName, identity), hardwareType(hardwareType), side(side), identifierByte(identifierByte) {
     profile = nullptr;
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageBytesPerLine, ' '));
-    lastUpdateCycle = 0;
+    shownRevision = 0;
+    lastRenderTime = {};
+    setMaxRefreshRate(FMC_MAX_REFRESH_RATE);
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
     pressedButtonIndices = {};
     fontUpdatingEnabled = true;
 
+    lastFrame.reserve(FMCPacketizer::MaxReports * FMCPacketizer::ReportLength);
+    lastFrameHash = 0;
+
     connect();
 }
 
 ProductFMC::~ProductFMC() {
     disconnect();
+
+    if (!maxRefreshRateRef.empty()) {
+        Dataref::getInstance()->unbind(maxRefreshRateRef.c_str());
+    }
 }
 
 void ProductFMC::setProfileForCurrentAircraft() {
@@ -67,6 +76,11 @@ void ProductFMC::setProfileForCurrentAircraft() {
         profile = new IXEG733FMCProfile(this);
         profileReady = true;
     }
+
+    if (profile) {
+        encoder.compile(profile);
+        page = FMCSharedPage::acquire(profile);
+    }
 }
 
 const char *ProductFMC::classIdentifier() {
@@ -83,27 +97,29 @@ const char *ProductFMC::classIdentifier() {
     return "Product FMC (unknown hardware)";
 }
 
+// The 0xf0 configuration goes on the bulk lane along with fonts, blanking and backgrounds, so the
+// unit gets all of it in order. Frames wait for that lane to drain, see updatePage().
 bool ProductFMC::connect() {
     if (USBDevice::connect()) {
         uint8_t col_bg[] = {0x00, 0x00, 0x00};
 
-        writeData({0xf0, 0x0, 0x1, 0x38, identifierByte, 0xbb, 0x0, 0x0, 0x1e, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x18, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x34, 0x0, 0x18, 0x0, 0xe, 0x0, 0x18, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x2, 0x38, 0x0, 0x0, 0x0, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x1, 0x0, 0x6, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x3, 0x38, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0xff, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x4, 0x38, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0xff, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x5, 0x38, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0x63, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x6, 0x38, 0xff, 0xff, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x7, 0x38, 0x0, 0x0, 0x2, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x42, 0x5c, 0x61, 0xff, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x8, 0x38, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x77, 0x77, 0x77, 0xff, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x5e, 0x73, 0x79, 0xff, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x9, 0x38, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, col_bg[0], col_bg[1], col_bg[2], 0xff, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xa, 0x38, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xb, 0x38, 0xff, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xc, 0x38, 0x0, 0x3, 0x0, 0xff, 0x63, 0xff, 0xff, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xd, 0x38, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x42, 0x5c, 0x61, 0xff, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xe, 0x38, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x77, 0x77, 0x77, 0xff, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5e, 0x73, 0x79, 0xff, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xf, 0x38, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x10, 0x38, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x1a, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x11, 0x12, 0x2, identifierByte, 0xbb, 0x0, 0x0, 0x1c, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
+        writeData({0xf0, 0x0, 0x1, 0x38, identifierByte, 0xbb, 0x0, 0x0, 0x1e, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x18, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x34, 0x0, 0x18, 0x0, 0xe, 0x0, 0x18, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x2, 0x38, 0x0, 0x0, 0x0, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x1, 0x0, 0x6, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x3, 0x38, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0xff, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x4, 0x38, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0xff, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x5, 0x38, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0x63, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x6, 0x38, 0xff, 0xff, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x7, 0x38, 0x0, 0x0, 0x2, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x42, 0x5c, 0x61, 0xff, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x8, 0x38, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x77, 0x77, 0x77, 0xff, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x5e, 0x73, 0x79, 0xff, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x9, 0x38, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, col_bg[0], col_bg[1], col_bg[2], 0xff, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0xa, 0x38, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0xb, 0x38, 0xff, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0xc, 0x38, 0x0, 0x3, 0x0, 0xff, 0x63, 0xff, 0xff, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0xd, 0x38, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x42, 0x5c, 0x61, 0xff, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0xe, 0x38, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x77, 0x77, 0x77, 0xff, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5e, 0x73, 0x79, 0xff, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0xf, 0x38, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x10, 0x38, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x1a, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
+        writeData({0xf0, 0x0, 0x11, 0x12, 0x2, identifierByte, 0xbb, 0x0, 0x0, 0x1c, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, USBWritePriority::Bulk);
 
         setLedBrightness(FMCLed::BACKLIGHT, 128);
         setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
@@ -114,10 +130,7 @@ bool ProductFMC::connect() {
         setLedBrightness(FMCLed::MCDU_FAIL, 1);
         setLedBrightness(FMCLed::PFP_FAIL, 1);
 
-        if (!profile) {
-            setProfileForCurrentAircraft();
-        }
-
+        // The profile is bound from update(), on the main thread
         return true;
     }
 
@@ -125,12 +138,12 @@ bool ProductFMC::connect() {
 }
 
 void ProductFMC::disconnect() {
+    unloadProfile();
+
     setLedBrightness(FMCLed::BACKLIGHT, 0);
     setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 0);
     setAllLedsEnabled(false);
 
-    unloadProfile();
-
     USBDevice::disconnect();
 }
 
@@ -141,8 +154,18 @@ void ProductFMC::unloadProfile() {
         return;
     }
 
+    page.reset();
     delete profile;
     profile = nullptr;
+    uploadingFont.reset();
+
+    // The device stays connected for the next aircraft, so leave it in the same state connect() does.
+    shownScreen.clear();
+    shownRevision = 0;
+    pressedButtonIndices.clear();
+    setAllLedsEnabled(false);
+    clearDisplay();
+    showBackground(FMCBackgroundVariant::WINWING_LOGO);
 }
 
 void ProductFMC::update() {
@@ -243,109 +266,178 @@ void ProductFMC::didReceiveData(int reportId, uint8_t *report, int reportLength)
 }
 
 void ProductFMC::updatePage() {
-    auto datarefManager = Dataref::getInstance();
-    for (std::string dataref : profile->displayDatarefs()) {
-        if (!lastUpdateCycle || datarefManager->getCachedLastUpdate(dataref.c_str()) > lastUpdateCycle) {
-            profile->updatePage(page);
-            lastUpdateCycle = XPLMGetCycleNumber();
-            draw();
-        }
-    }
-}
+    // writeReport() only says a report was queued, the output thread tells us when one did not go out
+    if (takeWriteFailure()) {
+        invalidateLastFrame();
 
-void ProductFMC::draw(const std::vector<std::vector<char>> *pagePtr) {
-    const auto &p = pagePtr ? *pagePtr : page;
-    std::vector<uint8_t> buf;
+        // The failed report may have been part of a font, which then is no longer known to be resident
+        withRetainedState([](USBDeviceRetainedState &state) {
+            state.residentContent.erase("font");
+        });
+    }
 
-    for (int i = 0; i < ProductFMC::PageLines; ++i) {
-        for (int j = 0; j < ProductFMC::PageCharsPerLine; ++j) {
-            char color = p[i][j * ProductFMC::PageBytesPerChar];
-            bool fontSmall = p[i][j * ProductFMC::PageBytesPerChar + 1];
-            auto [dataLow, dataHigh] = dataFromColFont(color, fontSmall);
-            buf.push_back(dataLow);
-            buf.push_back(dataHigh);
+    // Nothing gets through until the device is reconnected, which redraws it from scratch
+    if (health == USBDeviceHealth::Lost) {
+        return;
+    }
 
-            char val = p[i][j * ProductFMC::PageBytesPerChar + ProductFMC::PageBytesPerChar - 1];
-            profile->mapCharacter(&buf, val, fontSmall);
-        }
+    // A frame would overtake a font upload or configuration still on its way. Those invalidate
+    // the last frame, so the page is drawn again once they are out.
+    if (hasPendingWrites(USBWritePriority::Bulk)) {
+        return;
     }
 
-    while (!buf.empty()) {
-        size_t maxLength = std::min<size_t>(63, buf.size());
-        std::vector<uint8_t> usbBuf(buf.begin(), buf.begin() + maxLength);
-        usbBuf.insert(usbBuf.begin(), 0xf2);
-        if (maxLength < 63) {
-            usbBuf.insert(usbBuf.end(), 63 - maxLength, 0);
+    // The upload is through, unless it lost a report on the way. Then setFont() sends it again.
+    if (uploadingFont) {
+        FontVariant variant = *uploadingFont;
+        uploadingFont.reset();
+        setFont(variant);
+        if (uploadingFont) {
+            return;
         }
-        writeData(usbBuf);
-        buf.erase(buf.begin(), buf.begin() + maxLength);
     }
-}
 
-std::pair<uint8_t, uint8_t> ProductFMC::dataFromColFont(char color, bool fontSmall) {
-    if (!profile) {
-        return {0x42, 0x00}; // Default white
+    // A display in an unknown state is drawn again even when the page did not change
+    page->poll(profile);
+    if (!page->hasPendingRows() && page->revision() == shownRevision && !lastFrame.empty()) {
+        return;
     }
 
-    const std::map<char, FMCTextColor> &col_map = profile->colorMap();
-
-    auto it = col_map.find(color);
-    int value = it != col_map.end() ? it->second : FMCTextColor::COLOR_WHITE;
-    if (fontSmall) {
-        value += 0x016b;
+    // The first change after a quiet spell is drawn straight away, a burst of them is held
+    // back and drawn in one go once the interval is up
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastRenderTime < minRenderInterval) {
+        return;
+    }
+    lastRenderTime = now;
+
+    // A no-op when another unit showing the same side already rendered the changes
+    page->render(profile);
+    shownRevision = page->revision();
+
+    // Nothing to encode when the render came out the same as what is shown. After a dropped
+    // frame the encoder may hold lines that never made it out, so every line is encoded again.
+    const FMCScreen &screen = page->screen();
+    FMCRowMask changedRows = lastFrame.empty() ? FMCScreen::AllRows : screen.rowsDifferingFrom(shownScreen);
+    if (changedRows && draw(screen, changedRows)) {
+        shownScreen = screen;
     }
-
-    return {static_cast<uint8_t>(value & 0xFF), static_cast<uint8_t>((value >> 8) & 0xFF)};
 }
 
-void ProductFMC::writeLineToPage(std::vector<std::vector<char>> &page, int line, int pos, const std::string &text, char color, bool fontSmall) {
-    if (line < 0 || line >= ProductFMC::PageLines) {
-        debug("Not writing line %i: Line number is out of range!\n", line);
-        return;
+// Returns whether the display shows screen now, as far as the output queue can tell
+bool ProductFMC::draw(const FMCScreen &screen, FMCRowMask changedRows) {
+    encoder.encode(screen, changedRows, packetizer);
+
+    if (packetizer.overflowed()) {
+        debug("[%s] Encoded frame does not fit the display stream, dropping it.\n", classIdentifier());
+        invalidateLastFrame();
+        return false;
     }
-    if (pos < 0 || pos + text.length() > ProductFMC::PageCharsPerLine) {
-        debug("Not writing line %i: Position number (%i) is out of range!\n", line, pos);
-        return;
+    std::span<const uint8_t> frame = packetizer.reports();
+
+    // Profiles re-render on any display dataref change, most of which don't change what is shown.
+    // The 0xf2 stream has no row or offset addressing, so a frame that differs goes out whole.
+    uint64_t frameHash = 0xcbf29ce484222325ULL;
+    for (uint8_t byte : frame) {
+        frameHash ^= byte;
+        frameHash *= 0x100000001b3ULL;
     }
-    if (text.length() > ProductFMC::PageCharsPerLine) {
-        debug("Not writing line %i: Text is too long (%lu) for line.\n", line, text.length());
-        return;
+    if (!lastFrame.empty() && frameHash == lastFrameHash && std::equal(frame.begin(), frame.end(), lastFrame.begin(), lastFrame.end())) {
+        return true;
+    }
+
+    bool sent = true;
+    for (size_t i = 0; i < packetizer.reportCount(); ++i) {
+        sent = writeReport(packetizer.report(i), USBWritePriority::Display) && sent;
     }
 
-    pos = pos * ProductFMC::PageBytesPerChar;
-    for (size_t c = 0; c < text.length(); ++c) {
-        page[line][pos + c * ProductFMC::PageBytesPerChar] = color;
-        page[line][pos + c * ProductFMC::PageBytesPerChar + 1] = fontSmall;
-        page[line][pos + c * ProductFMC::PageBytesPerChar + ProductFMC::PageBytesPerChar - 1] = text[c];
+    // A frame that only partly made it into the queue leaves the display in an unknown state
+    if (sent) {
+        lastFrame.assign(frame.begin(), frame.end());
+        lastFrameHash = frameHash;
+    } else {
+        invalidateLastFrame();
     }
+    return sent;
+}
+
+void ProductFMC::invalidateLastFrame() {
+    lastFrame.clear();
+    lastFrameHash = 0;
 }
 
 void ProductFMC::clearDisplay() {
-    std::vector<uint8_t> blankLine = {};
-    blankLine.push_back(0xf2);
+    invalidateLastFrame();
+
+    std::array<uint8_t, 1 + ProductFMC::PageCharsPerLine * 3> blankLine;
+    blankLine[0] = 0xf2;
     for (int i = 0; i < ProductFMC::PageCharsPerLine; ++i) {
-        blankLine.push_back(0x42);
-        blankLine.push_back(0x00);
-        blankLine.push_back(' ');
+        blankLine[1 + i * 3] = 0x42;
+        blankLine[2 + i * 3] = 0x00;
+        blankLine[3 + i * 3] = ' ';
     }
 
     for (int i = 0; i < 16; ++i) {
-        writeData(blankLine);
+        writeReport(blankLine, USBWritePriority::Bulk);
+    }
+}
+
+void ProductFMC::setFont(FontVariant variant) {
+    if (!fontUpdatingEnabled) {
+        return;
+    }
+
+    // The uploaded glyphs carry the identifier byte, so it is part of what is resident.
+    uint64_t fontHash = (Font::ContentHash(variant) ^ identifierByte) * 1099511628211ULL;
+    bool alreadyResident = false;
+    withRetainedState([&](USBDeviceRetainedState &state) {
+        auto resident = state.residentContent.find("font");
+        alreadyResident = resident != state.residentContent.end() && resident->second == fontHash;
+    });
+    if (alreadyResident) {
+        debug("[%s] Font %d already resident, skipping upload.\n", classIdentifier(), (int) variant);
+        return;
+    }
+
+    invalidateLastFrame();
+    bool queued = true;
+    Font::ForEachPacket(variant, identifierByte, [this, &queued](std::span<const uint8_t> packet) {
+        queued = queued && writeReport(packet, USBWritePriority::Bulk);
+    });
+    uploadingFont = variant;
+
+    // A font missing some of its packets must not be taken for resident, or it is never sent again
+    withRetainedState([&](USBDeviceRetainedState &state) {
+        if (queued) {
+            state.residentContent["font"] = fontHash;
+        } else {
+            state.residentContent.erase("font");
+        }
+    });
+    if (!queued) {
+        debug("[%s] Font %d did not fit in the output queue, uploading it again later.\n", classIdentifier(), (int) variant);
     }
 }
 
-void ProductFMC::setFont(std::vector<std::vector<unsigned char>> font) {
+void ProductFMC::setFont(const std::vector<std::vector<unsigned char>> &font) {
     if (!fontUpdatingEnabled) {
         return;
     }
 
+    // Raw glyph data can be anything, so we no longer know what is resident.
+    withRetainedState([](USBDeviceRetainedState &state) {
+        state.residentContent.erase("font");
+    });
+    uploadingFont.reset();
+    invalidateLastFrame();
+
     for (auto &fontBytes : font) {
-        writeData(fontBytes);
+        writeReport(fontBytes, USBWritePriority::Bulk);
     }
 }
 
 void ProductFMC::showBackground(FMCBackgroundVariant variant) {
-    std::vector<uint8_t> data;
+    std::array<uint8_t, 64> data = {};
 
     switch (variant) {
         case FMCBackgroundVariant::GRAY:
@@ -384,11 +476,37 @@ void ProductFMC::showBackground(FMCBackgroundVariant variant) {
             return;
     }
 
-    std::vector<uint8_t> extra = {
-        0x00, 0x01, 0x00, 0x00, 0x00, static_cast<uint8_t>(0x0c + (int) variant), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    data.insert(data.end(), extra.begin(), extra.end());
+    // Remaining 48 bytes are zero apart from the background selector.
+    data[17] = 0x01;
+    data[21] = static_cast<uint8_t>(0x0c + (int) variant);
+
+    writeReport(data, USBWritePriority::Bulk);
+}
+
+void ProductFMC::publishSettings(const std::string &deviceName) {
+    if (!maxRefreshRateRef.empty()) {
+        Dataref::getInstance()->unbind(maxRefreshRateRef.c_str());
+    }
+
+    maxRefreshRateRef = "winwing/settings/" + deviceName + "/max_refresh_rate";
+    Dataref::getInstance()->createDataref<int>(maxRefreshRateRef.c_str(), &maxRefreshRate, true, [this](int framesPerSecond) {
+        if (framesPerSecond < 0) {
+            return false;
+        }
+
+        setMaxRefreshRate(framesPerSecond);
+        return true;
+    });
+}
+
+void ProductFMC::setMaxRefreshRate(unsigned int framesPerSecond) {
+    maxRefreshRate = (int) framesPerSecond;
+    if (framesPerSecond == 0) {
+        minRenderInterval = std::chrono::steady_clock::duration::zero();
+        return;
+    }
 
-    writeData(data);
+    minRenderInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / framesPerSecond;
 }
 
 void ProductFMC::setAllLedsEnabled(bool enable) {
@@ -415,5 +533,6 @@ void ProductFMC::setLedBrightness(FMCLed led, uint8_t brightness) {
         return;
     }
 
-    writeData({0x02, identifierByte, 0xbb, 0x00, 0x00, 0x03, 0x49, led, brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    const std::array<uint8_t, 14> report = {0x02, identifierByte, 0xbb, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
+    writeReport(report);
 }
@@ -2,47 +2,70 @@
 #define PRODUCT_FMC_H
 
 #include "fmc-aircraft-profile.h"
+#include "fmc-encoder.h"
+#include "fmc-screen.h"
+#include "fmc-shared-page.h"
+#include "font.h"
 #include "usbdevice.h"
 
+#include <array>
 #include <chrono>
 #include <map>
+#include <optional>
 #include <set>
 
 class ProductFMC : public USBDevice {
     private:
         FMCAircraftProfile *profile;
-        std::vector<std::vector<char>> page;
-        int lastUpdateCycle;
+        std::shared_ptr<FMCSharedPage> page; // Shared with the other units showing the same side
+        FMCScreen shownScreen;
+        uint64_t shownRevision;
+
+        // Changes are drawn together, no more often than minRenderInterval allows
+        int maxRefreshRate;
+        std::string maxRefreshRateRef;
+        std::chrono::steady_clock::duration minRenderInterval;
+        std::chrono::steady_clock::time_point lastRenderTime;
         std::set<int> pressedButtonIndices;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
+        FMCEncoder encoder;
+        FMCPacketizer packetizer;
+
+        // The encoded frame the display currently shows, empty when that is unknown
+        std::vector<uint8_t> lastFrame;
+        uint64_t lastFrameHash;
+
+        // A font upload that is still on the bulk lane, uploaded again if it does not arrive in full
+        std::optional<FontVariant> uploadingFont;
 
         void updatePage();
-        void draw(const std::vector<std::vector<char>> *pagePtr = nullptr);
-        std::pair<uint8_t, uint8_t> dataFromColFont(char color, bool fontSmall = false);
+        bool draw(const FMCScreen &screen, FMCRowMask changedRows);
+        void invalidateLastFrame();
 
         void setProfileForCurrentAircraft();
 
     public:
-        ProductFMC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, FMCHardwareType hardwareType, unsigned char identifierByte);
+        ProductFMC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, FMCHardwareType hardwareType, FMCSide side, unsigned char identifierByte, std::string identity);
         ~ProductFMC();
 
-        static constexpr unsigned int PageLines = 14; // Header + 6 * label + 6 * cont + textbox
-        static constexpr unsigned int PageCharsPerLine = 24;
-        static constexpr unsigned int PageBytesPerChar = 3;
-        static constexpr unsigned int PageBytesPerLine = PageCharsPerLine * PageBytesPerChar;
+        static constexpr unsigned int PageLines = FMCScreen::Lines; // Header + 6 * label + 6 * cont + textbox
+        static constexpr unsigned int PageCharsPerLine = FMCScreen::CharsPerLine;
         FMCHardwareType hardwareType;
+        const FMCSide side;
         const unsigned char identifierByte;
         bool fontUpdatingEnabled;
 
         const char *classIdentifier() override;
         bool connect() override;
         void disconnect() override;
-        void unloadProfile();
+        void unloadProfile() override;
         void update() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
-        void writeLineToPage(std::vector<std::vector<char>> &page, int line, int pos, const std::string &text, char color, bool fontSmall = false);
-        void setFont(std::vector<std::vector<unsigned char>> font);
+        void publishSettings(const std::string &deviceName) override;
+        void setFont(FontVariant variant);
+        void setFont(const std::vector<std::vector<unsigned char>> &font);
+        void setMaxRefreshRate(unsigned int framesPerSecond);
 
         void setAllLedsEnabled(bool enable);
         void setLedBrightness(FMCLed led, uint8_t brightness);
@@ -13,23 +13,33 @@
 #include <XPLMProcessing.h>
 
 FlightFactor767FMCProfile::FlightFactor767FMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
+    followUnitSide();
+    sideDisplayDatarefs = forSide(captainDisplayDatarefs(), "cduL", "cduR");
+    sideButtonDefs = forSide(captainButtonDefs(), "757Avionics/CDU/", "757Avionics/CDU2/");
+
+    std::string cdu = side == FMCSide::FirstOfficer ? "cduR" : "cduL";
+    symbolsRef = "1-sim/" + cdu + "/display/symbols";
+    symbolsColorRef = "1-sim/" + cdu + "/display/symbolsColor";
+    symbolsSizeRef = "1-sim/" + cdu + "/display/symbolsSize";
+    symbolsEffectsRef = "1-sim/" + cdu + "/display/symbolsEffects";
+
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::Font737, product->identifierByte));
+    product->setFont(FontVariant::Font737);
 
     Dataref::getInstance()->monitorExistingDataref<float>("sim/cockpit/electrical/instrument_brightness", [product](float brightness) {
         uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? brightness * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
     
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/instrument_brightness");
-    });
+    }, this);
 }
 
 FlightFactor767FMCProfile::~FlightFactor767FMCProfile() {
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/instrument_brightness");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/instrument_brightness", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
 }
 
 bool FlightFactor767FMCProfile::IsEligible() {
@@ -46,6 +56,14 @@ bool FlightFactor767FMCProfile::IsEligible() {
 }
 
 const std::vector<std::string>& FlightFactor767FMCProfile::displayDatarefs() const {
+    return sideDisplayDatarefs;
+}
+
+const std::vector<FMCButtonDef>& FlightFactor767FMCProfile::buttonDefs() const {
+    return sideButtonDefs;
+}
+
+const std::vector<std::string>& FlightFactor767FMCProfile::captainDisplayDatarefs() {
     static const std::vector<std::string> datarefs = {
         "1-sim/cduL/display/symbols", // 336 letters
         "1-sim/cduL/display/symbolsColor", // 336 numbers
@@ -56,7 +74,7 @@ const std::vector<std::string>& FlightFactor767FMCProfile::displayDatarefs() con
     return datarefs;
 }
 
-const std::vector<FMCButtonDef>& FlightFactor767FMCProfile::buttonDefs() const {
+const std::vector<FMCButtonDef>& FlightFactor767FMCProfile::captainButtonDefs() {
     static const std::vector<FMCButtonDef> buttons = {
         {FMCKey::LSK1L, "757Avionics/CDU/LLSK1"},
         {FMCKey::LSK2L, "757Avionics/CDU/LLSK2"},
@@ -147,14 +165,14 @@ const std::map<char, FMCTextColor>& FlightFactor767FMCProfile::colorMap() const
     return colMap;
 }
 
-void FlightFactor767FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void FlightFactor767FMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '#':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
             
         case '*':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
         
         default:
@@ -163,14 +181,12 @@ void FlightFactor767FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8
     }
 }
 
-void FlightFactor767FMCProfile::updatePage(std::vector<std::vector<char>>& page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
-    
+void FlightFactor767FMCProfile::updatePage(FMCScreen &screen) {
     auto datarefManager = Dataref::getInstance();
-    std::vector<unsigned char> symbols = datarefManager->getCached<std::vector<unsigned char>>("1-sim/cduL/display/symbols");
-    std::vector<int> colors = datarefManager->getCached<std::vector<int>>("1-sim/cduL/display/symbolsColor");
-    std::vector<int> sizes = datarefManager->getCached<std::vector<int>>("1-sim/cduL/display/symbolsSize");
-    std::vector<int> effects = datarefManager->getCached<std::vector<int>>("1-sim/cduL/display/symbolsEffects");
+    std::span<const unsigned char> symbols = datarefManager->getCachedSpan<unsigned char>(symbolsRef.c_str());
+    std::span<const int> colors = datarefManager->getCachedSpan<int>(symbolsColorRef.c_str());
+    std::span<const int> sizes = datarefManager->getCachedSpan<int>(symbolsSizeRef.c_str());
+    std::span<const int> effects = datarefManager->getCachedSpan<int>(symbolsEffectsRef.c_str());
     
     if (symbols.size() < FlightFactor767FMCProfile::DataLength || colors.size() < FlightFactor767FMCProfile::DataLength || sizes.size() < FlightFactor767FMCProfile::DataLength || effects.size() < FlightFactor767FMCProfile::DataLength) {
         return;
@@ -199,7 +215,7 @@ void FlightFactor767FMCProfile::updatePage(std::vector<std::vector<char>>& page)
                 color = 6;
             }
             
-            product->writeLineToPage(page, line, pos, std::string(1, symbol), color, fontSmall);
+            screen.putChar(line, pos, symbol, color, fontSmall, effect);
         }
     }
 }
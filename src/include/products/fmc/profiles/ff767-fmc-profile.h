@@ -9,6 +9,15 @@ private:
     static std::vector<std::string> datarefsList;
     static std::vector<FMCButtonDef> buttonsList;
     static std::map<char, int> colors;
+    std::vector<std::string> sideDisplayDatarefs;
+    std::vector<FMCButtonDef> sideButtonDefs;
+    std::string symbolsRef;
+    std::string symbolsColorRef;
+    std::string symbolsSizeRef;
+    std::string symbolsEffectsRef;
+
+    static const std::vector<std::string>& captainDisplayDatarefs();
+    static const std::vector<FMCButtonDef>& captainButtonDefs();
         
 public:
     FlightFactor767FMCProfile(ProductFMC *product);
@@ -20,8 +29,8 @@ public:
     const std::vector<std::string>& displayDatarefs() const override;
     const std::vector<FMCButtonDef>& buttonDefs() const override;
     const std::map<char, FMCTextColor>& colorMap() const override;
-    void mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) override;
-    void updatePage(std::vector<std::vector<char>>& page) override;
+    void mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) override;
+    void updatePage(FMCScreen &screen) override;
     void buttonPressed(const FMCButtonDef *button, XPLMCommandPhase phase) override;
 };
 
@@ -10,46 +10,61 @@
 
 FlightFactor777FMCProfile::FlightFactor777FMCProfile(ProductFMC *product) :
     FMCAircraftProfile(product) {
+    followUnitSide();
+    sideDisplayDatarefs = forSide(captainDisplayDatarefs(), "cduL", "cduR");
+    sideButtonDefs = forSide(captainButtonDefs(), "cduL", "cduR");
+
+    std::string cdu = side == FMCSide::FirstOfficer ? "cduR" : "cduL";
+    symbolsRef = "1-sim/" + cdu + "/display/symbols";
+    symbolsColorRef = "1-sim/" + cdu + "/display/symbolsColor";
+    symbolsSizeRef = "1-sim/" + cdu + "/display/symbolsSize";
+    symbolsEffectsRef = "1-sim/" + cdu + "/display/symbolsEffects";
+    brightnessRef = forSide("1-sim/cduL/brt", "1-sim/cduR/brt");
+    poweredRef = forSide("1-sim/cduL/ok", "1-sim/cduR/ok");
+    execLampRef = forSide("1-sim/ckpt/lamps/cduCptAct", "1-sim/ckpt/lamps/cduFoAct");
+    messageLampRef = forSide("1-sim/ckpt/lamps/cduCptMSG", "1-sim/ckpt/lamps/cduFoMSG");
+    offsetLampRef = forSide("1-sim/ckpt/lamps/cduCptOFST", "1-sim/ckpt/lamps/cduFoOFST");
+
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::Font737, product->identifierByte));
+    product->setFont(FontVariant::Font737);
 
-    Dataref::getInstance()->monitorExistingDataref<float>("1-sim/cduL/brt", [product](float brightness) {
-        uint8_t target = Dataref::getInstance()->get<bool>("1-sim/cduL/ok") ? brightness * 255.0f : 0;
+    Dataref::getInstance()->monitorExistingDataref<float>(brightnessRef.c_str(), [this, product](float brightness) {
+        uint8_t target = Dataref::getInstance()->get<bool>(poweredRef.c_str()) ? brightness * 255.0f : 0;
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/lights/aisle", [product](float brightness) {
-        uint8_t target = Dataref::getInstance()->get<bool>("1-sim/cduL/ok") ? brightness * 255.0f : 0;
+    Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/lights/aisle", [this, product](float brightness) {
+        uint8_t target = Dataref::getInstance()->get<bool>(poweredRef.c_str()) ? brightness * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/cduL/ok", [](bool poweredOn) {
-        Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/cduL/brt");
+    Dataref::getInstance()->monitorExistingDataref<bool>(poweredRef.c_str(), [this](bool poweredOn) {
+        Dataref::getInstance()->executeChangedCallbacksForDataref(brightnessRef.c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lights/aisle");
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lamps/cduCptAct", [product](bool enabled) {
+    Dataref::getInstance()->monitorExistingDataref<bool>(execLampRef.c_str(), [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_EXEC, enabled ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_MCDU, enabled ? 1 : 0);
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lamps/cduCptMSG", [product](bool enabled) {
+    Dataref::getInstance()->monitorExistingDataref<bool>(messageLampRef.c_str(), [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_MSG, enabled ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_RDY, enabled ? 1 : 0);
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lamps/cduCptOFST", [product](bool enabled) {
+    Dataref::getInstance()->monitorExistingDataref<bool>(offsetLampRef.c_str(), [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_OFST, enabled ? 1 : 0);
-    });
+    }, this);
 }
 
 FlightFactor777FMCProfile::~FlightFactor777FMCProfile() {
-    Dataref::getInstance()->unbind("1-sim/cduL/brt");
-    Dataref::getInstance()->unbind("1-sim/ckpt/lights/aisle");
-    Dataref::getInstance()->unbind("1-sim/cduL/ok");
-    Dataref::getInstance()->unbind("1-sim/ckpt/lamps/cduCptAct");
-    Dataref::getInstance()->unbind("1-sim/ckpt/lamps/cduCptMSG");
-    Dataref::getInstance()->unbind("1-sim/ckpt/lamps/cduCptOFST");
+    Dataref::getInstance()->unbind(brightnessRef.c_str(), this);
+    Dataref::getInstance()->unbind("1-sim/ckpt/lights/aisle", this);
+    Dataref::getInstance()->unbind(poweredRef.c_str(), this);
+    Dataref::getInstance()->unbind(execLampRef.c_str(), this);
+    Dataref::getInstance()->unbind(messageLampRef.c_str(), this);
+    Dataref::getInstance()->unbind(offsetLampRef.c_str(), this);
 }
 
 bool FlightFactor777FMCProfile::IsEligible() {
@@ -57,6 +72,14 @@ bool FlightFactor777FMCProfile::IsEligible() {
 }
 
 const std::vector<std::string> &FlightFactor777FMCProfile::displayDatarefs() const {
+    return sideDisplayDatarefs;
+}
+
+const std::vector<FMCButtonDef> &FlightFactor777FMCProfile::buttonDefs() const {
+    return sideButtonDefs;
+}
+
+const std::vector<std::string> &FlightFactor777FMCProfile::captainDisplayDatarefs() {
     static const std::vector<std::string> datarefs = {
         "1-sim/cduL/display/symbols",        // 336 letters
         "1-sim/cduL/display/symbolsColor",   // 336 numbers
@@ -67,7 +90,7 @@ const std::vector<std::string> &FlightFactor777FMCProfile::displayDatarefs() con
     return datarefs;
 }
 
-const std::vector<FMCButtonDef> &FlightFactor777FMCProfile::buttonDefs() const {
+const std::vector<FMCButtonDef> &FlightFactor777FMCProfile::captainButtonDefs() {
     static const std::vector<FMCButtonDef> buttons = {
         {FMCKey::LSK1L, "1-sim/command/cduLLK1_button"},
         {FMCKey::LSK2L, "1-sim/command/cduLLK2_button"},
@@ -158,14 +181,14 @@ const std::map<char, FMCTextColor> &FlightFactor777FMCProfile::colorMap() const
     return colMap;
 }
 
-void FlightFactor777FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void FlightFactor777FMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '#':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         case '*':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
 
         default:
@@ -174,14 +197,12 @@ void FlightFactor777FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8
     }
 }
 
-void FlightFactor777FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
-
+void FlightFactor777FMCProfile::updatePage(FMCScreen &screen) {
     auto datarefManager = Dataref::getInstance();
-    std::vector<unsigned char> symbols = datarefManager->getCached<std::vector<unsigned char>>("1-sim/cduL/display/symbols");
-    std::vector<int> colors = datarefManager->getCached<std::vector<int>>("1-sim/cduL/display/symbolsColor");
-    std::vector<int> sizes = datarefManager->getCached<std::vector<int>>("1-sim/cduL/display/symbolsSize");
-    std::vector<int> effects = datarefManager->getCached<std::vector<int>>("1-sim/cduL/display/symbolsEffects");
+    std::span<const unsigned char> symbols = datarefManager->getCachedSpan<unsigned char>(symbolsRef.c_str());
+    std::span<const int> colors = datarefManager->getCachedSpan<int>(symbolsColorRef.c_str());
+    std::span<const int> sizes = datarefManager->getCachedSpan<int>(symbolsSizeRef.c_str());
+    std::span<const int> effects = datarefManager->getCachedSpan<int>(symbolsEffectsRef.c_str());
 
     if (symbols.size() < FlightFactor777FMCProfile::DataLength || colors.size() < FlightFactor777FMCProfile::DataLength || sizes.size() < FlightFactor777FMCProfile::DataLength || effects.size() < FlightFactor777FMCProfile::DataLength) {
         return;
@@ -210,7 +231,7 @@ void FlightFactor777FMCProfile::updatePage(std::vector<std::vector<char>> &page)
                 color = 6;
             }
 
-            product->writeLineToPage(page, line, pos, std::string(1, symbol), color, fontSmall);
+            screen.putChar(line, pos, symbol, color, fontSmall, effect);
         }
     }
 }
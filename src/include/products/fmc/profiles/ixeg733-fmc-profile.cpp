@@ -16,21 +16,21 @@
 IXEG733FMCProfile::IXEG733FMCProfile(ProductFMC *product) :
     FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::Font737, product->identifierByte));
+    product->setFont(FontVariant::Font737);
     Dataref::getInstance()->monitorExistingDataref<float>("ixeg/733/rheostats/light_fmc_pt_act", [product](float brightness) {
         uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? brightness * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("ixeg/733/rheostats/light_fmc_pt_act");
-    });
+    }, this);
 }
 
 IXEG733FMCProfile::~IXEG733FMCProfile() {
-    Dataref::getInstance()->unbind("ixeg/733/rheostats/light_fmc_pt_act");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
+    Dataref::getInstance()->unbind("ixeg/733/rheostats/light_fmc_pt_act", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
 }
 
 bool IXEG733FMCProfile::IsEligible() {
@@ -158,14 +158,14 @@ const std::map<char, FMCTextColor> &IXEG733FMCProfile::colorMap() const {
     return colMap;
 }
 
-void IXEG733FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void IXEG733FMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '#':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         case '`':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
 
         default:
@@ -224,9 +224,7 @@ std::pair<std::string, std::vector<char>> IXEG733FMCProfile::processIxegText(con
     return std::make_pair(text, colors);
 }
 
-void IXEG733FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
-
+void IXEG733FMCProfile::updatePage(FMCScreen &screen) {
     auto datarefManager = Dataref::getInstance();
     for (const auto &ref : displayDatarefs()) {
         std::vector<unsigned char> characters = datarefManager->getCached<std::vector<unsigned char>>(ref.c_str());
@@ -239,7 +237,7 @@ void IXEG733FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             for (int i = 0; i < text.size() && i < ProductFMC::PageCharsPerLine; ++i) {
                 char c = text[i];
                 char color = i < colors.size() ? colors[i] : 'G';
-                product->writeLineToPage(page, 0, i, std::string(1, c), color, color == 'S');
+                screen.putChar(0, i, c, color, color == 'S');
             }
             continue;
         }
@@ -250,7 +248,7 @@ void IXEG733FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
                 for (int i = 0; i < text.size() && (startPos + i) < ProductFMC::PageCharsPerLine; ++i) {
                     char c = text[i];
                     char color = i < colors.size() ? colors[i] : 'G';
-                    product->writeLineToPage(page, 0, startPos + i, std::string(1, c), color, color == 'S');
+                    screen.putChar(0, startPos + i, c, color, color == 'S');
                 }
             }
             continue;
@@ -260,7 +258,7 @@ void IXEG733FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             for (int i = 0; i < text.size() && i < ProductFMC::PageCharsPerLine; ++i) {
                 char c = text[i];
                 char color = i < colors.size() ? colors[i] : 'G';
-                product->writeLineToPage(page, 13, i, std::string(1, c), color, color == 'S');
+                screen.putChar(13, i, c, color, color == 'S');
             }
             continue;
         }
@@ -292,7 +290,7 @@ void IXEG733FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
                     for (int i = 0; i < text.size() && (startPos + i) < ProductFMC::PageCharsPerLine; ++i) {
                         char c = text[i];
                         char color = i < colors.size() ? colors[i] : 'G';
-                        product->writeLineToPage(page, displayLine, startPos + i, std::string(1, c), color, isTitle || color == 'S');
+                        screen.putChar(displayLine, startPos + i, c, color, isTitle || color == 'S');
                     }
                 }
             }
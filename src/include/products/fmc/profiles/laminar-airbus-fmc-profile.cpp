@@ -10,7 +10,7 @@
 LaminarFMCProfile::LaminarFMCProfile(ProductFMC *product) :
     FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::FontAirbus, product->identifierByte));
+    product->setFont(FontVariant::FontAirbus);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio", [product](std::vector<float> brightness) {
         if (brightness.size() <= 6) {
@@ -20,19 +20,19 @@ LaminarFMCProfile::LaminarFMCProfile(ProductFMC *product) :
         uint8_t target = Dataref::getInstance()->getCached<bool>("sim/cockpit/electrical/avionics_on") ? brightness[6] * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
-    });
+    }, this);
 
     product->setLedBrightness(FMCLed::BACKLIGHT, 128);
     product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
 }
 
 LaminarFMCProfile::~LaminarFMCProfile() {
-    Dataref::getInstance()->unbind("sim/cockpit2/electrical/instrument_brightness_ratio");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
+    Dataref::getInstance()->unbind("sim/cockpit2/electrical/instrument_brightness_ratio", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
 }
 
 bool LaminarFMCProfile::IsEligible() {
@@ -152,15 +152,15 @@ const std::map<char, FMCTextColor> &LaminarFMCProfile::colorMap() const {
     return colMap;
 }
 
-void LaminarFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void LaminarFMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '#':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         case '<':
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_LEFT.begin(), FMCSpecialCharacter::ARROW_LEFT.end());
+                buffer->append(FMCSpecialCharacter::ARROW_LEFT);
             } else {
                 buffer->push_back(character);
             }
@@ -168,7 +168,7 @@ void LaminarFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t chara
 
         case '>':
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_RIGHT.begin(), FMCSpecialCharacter::ARROW_RIGHT.end());
+                buffer->append(FMCSpecialCharacter::ARROW_RIGHT);
             } else {
                 buffer->push_back(character);
             }
@@ -176,20 +176,20 @@ void LaminarFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t chara
 
         case 30: // Up arrow
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_UP.begin(), FMCSpecialCharacter::ARROW_UP.end());
+                buffer->append(FMCSpecialCharacter::ARROW_UP);
             }
             break;
 
         case 31: // Down arrow
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_DOWN.begin(), FMCSpecialCharacter::ARROW_DOWN.end());
+                buffer->append(FMCSpecialCharacter::ARROW_DOWN);
             } else {
                 buffer->push_back(character);
             }
             break;
 
         case '`':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
 
         default:
@@ -198,9 +198,7 @@ void LaminarFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t chara
     }
 }
 
-void LaminarFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
-
+void LaminarFMCProfile::updatePage(FMCScreen &screen) {
     auto datarefManager = Dataref::getInstance();
     for (int lineNum = 0; lineNum < std::min(ProductFMC::PageLines, (unsigned int) 16); ++lineNum) {
         std::string textDataref = "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(lineNum);
@@ -251,7 +249,7 @@ void LaminarFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
                 break;
             }
 
-            product->writeLineToPage(page, displayLine, i, std::string(1, c), styleByte & 0x0F, fontSmall);
+            screen.putChar(displayLine, i, c, styleByte & 0x0F, fontSmall);
         }
     }
 }
@@ -13,8 +13,8 @@ class LaminarFMCProfile : public FMCAircraftProfile {
         const std::vector<std::string> &displayDatarefs() const override;
         const std::vector<FMCButtonDef> &buttonDefs() const override;
         const std::map<char, FMCTextColor> &colorMap() const override;
-        void mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) override;
-        void updatePage(std::vector<std::vector<char>> &page) override;
+        void mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) override;
+        void updatePage(FMCScreen &screen) override;
         void buttonPressed(const FMCButtonDef *button, XPLMCommandPhase phase) override;
 };
 
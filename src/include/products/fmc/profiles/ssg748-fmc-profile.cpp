@@ -11,10 +11,26 @@
 
 SSG748FMCProfile::SSG748FMCProfile(ProductFMC *product) :
     FMCAircraftProfile(product) {
-    datarefRegex = std::regex("SSG/UFMC/LINE_([0-9]+)");
+    std::regex datarefRegex("SSG/UFMC/LINE_([0-9]+)");
+    for (const auto &ref : displayDatarefs()) {
+        std::smatch match;
+        if (!std::regex_match(ref, match, datarefRegex)) {
+            continue;
+        }
+
+        int lineIndex = std::stoi(match[1]) - 1;
+        if (lineIndex < 0 || lineIndex >= ProductFMC::PageLines) {
+            continue;
+        }
+
+        // Colors are switched inline with ;X sequences, every line starts out white
+        bool fontSmall = lineIndex % 2 == 1;
+        FMCDisplayBindingKind kind = fontSmall ? FMCDisplayBindingKind::Label : FMCDisplayBindingKind::Content;
+        displayBindings.push_back({ref.c_str(), kind, (unsigned char) lineIndex, 'W', fontSmall});
+    }
 
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::FontVGA1, product->identifierByte));
+    product->setFont(FontVariant::FontVGA1);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("ssg/LGT/mcdu_brt_sw", [product](std::vector<float> brightness) {
         if (brightness.size() < 27) {
@@ -24,16 +40,16 @@ SSG748FMCProfile::SSG748FMCProfile(ProductFMC *product) :
         uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? brightness[10] * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("ssg/LGT/mcdu_brt_sw");
-    });
+    }, this);
 }
 
 SSG748FMCProfile::~SSG748FMCProfile() {
-    Dataref::getInstance()->unbind("ssg/LGT/mcdu_brt_sw");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
+    Dataref::getInstance()->unbind("ssg/LGT/mcdu_brt_sw", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
 }
 
 bool SSG748FMCProfile::IsEligible() {
@@ -154,14 +170,14 @@ const std::map<char, FMCTextColor> &SSG748FMCProfile::colorMap() const {
     return colMap;
 }
 
-void SSG748FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void SSG748FMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '#':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         case '=':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
 
         default:
@@ -170,30 +186,25 @@ void SSG748FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t charac
     }
 }
 
-void SSG748FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
+void SSG748FMCProfile::updatePage(FMCScreen &screen) {
+    updateRows(screen, FMCScreen::AllRows);
+}
 
+void SSG748FMCProfile::updateRows(FMCScreen &screen, FMCRowMask rows) {
     auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
-        std::smatch match;
-        if (!std::regex_match(ref, match, datarefRegex)) {
+    for (const auto &binding : displayBindings) {
+        if (!(rows & FMCScreen::rowMask(binding.row))) {
             continue;
         }
 
-        int lineNum = std::stoi(match[1]);
-        int lineIndex = lineNum - 1;
-
-        if (lineIndex < 0 || lineIndex >= ProductFMC::PageLines) {
-            continue;
-        }
-
-        std::string text = datarefManager->getCached<std::string>(ref.c_str());
+        std::string text = datarefManager->getCached<std::string>(binding.ref);
         if (text.empty()) {
             continue;
         }
 
-        char currentColor = 'W';
-        bool fontSmall = lineIndex % 2 == 1;
+        int lineIndex = binding.row;
+        char currentColor = binding.color;
+        bool fontSmall = binding.fontSmall;
         int displayPos = 0;
 
         for (int i = 0; i < text.size() && displayPos < ProductFMC::PageCharsPerLine; ++i) {
@@ -210,14 +221,14 @@ void SSG748FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             }
 
             if (c == '[' && i + 1 < text.size() && text[i + 1] == ']') {
-                product->writeLineToPage(page, lineIndex, displayPos, "#", currentColor, fontSmall);
+                screen.putChar(lineIndex, displayPos, '#', currentColor, fontSmall);
                 i++; // Skip the closing bracket
                 displayPos++;
                 continue;
             }
 
             if (c != 0x20) {
-                product->writeLineToPage(page, lineIndex, displayPos, std::string(1, toupper(c)), currentColor, fontSmall);
+                screen.putChar(lineIndex, displayPos, (char) toupper(c), currentColor, fontSmall);
             }
             displayPos++;
         }
@@ -6,38 +6,76 @@
 #include "product-fmc.h"
 
 #include <algorithm>
+#include <regex>
 
 TolissFMCProfile::TolissFMCProfile(ProductFMC *product) :
     FMCAircraftProfile(product) {
-    datarefRegex = std::regex("AirbusFBW/MCDU(1|2)([s]{0,1})([a-zA-Z]+)([0-6]{0,1})([L]{0,1})([a-z]{1})");
+    followUnitSide();
+    std::string mcduIndex = side == FMCSide::FirstOfficer ? "2" : "1";
+    sideDisplayDatarefs = forSide(captainDisplayDatarefs(), "MCDU1", "MCDU2");
+    sideButtonDefs = forSide(captainButtonDefs(), "MCDU1", "MCDU2");
+    vertSlewKeysRef = "AirbusFBW/MCDU" + mcduIndex + "VertSlewKeys";
+
+    std::regex datarefRegex("AirbusFBW/MCDU(1|2)([s]{0,1})([a-zA-Z]+)([0-6]{0,1})([L]{0,1})([a-z]{1})");
+    for (const auto &ref : displayDatarefs()) {
+        std::smatch match;
+        if (!std::regex_match(ref, match, datarefRegex) || match[1] != mcduIndex) {
+            continue;
+        }
+
+        std::string type = match[3];
+        char color = match[6].str()[0];
+        FMCDisplayBinding binding = {ref.c_str(), FMCDisplayBindingKind::Content, 0, color, false};
+        binding.fontSmall = match[2] == "s" || (type == "label" && match[5] != "L") || color == 's';
+
+        if (type.find("title") != std::string::npos) {
+            binding.kind = FMCDisplayBindingKind::Title;
+        } else if (type.find("label") != std::string::npos) {
+            binding.kind = FMCDisplayBindingKind::Label;
+            binding.row = (match[4].str().empty() ? 1 : std::stoi(match[4])) * 2 - 1;
+        } else if (type.find("cont") != std::string::npos) {
+            binding.row = match[4].str().empty() ? 0 : std::stoi(match[4]) * 2;
+        } else if (ref.ends_with("spw") || ref.ends_with("spa")) {
+            // Both scratchpad layers end up merged into the bottom line in updateRows
+            binding.kind = FMCDisplayBindingKind::Scratchpad;
+            binding.row = 13;
+            binding.color = ref.back() == 'w' ? 'w' : 'a';
+        } else {
+            continue;
+        }
+
+        displayBindings.push_back(binding);
+    }
 
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::FontAirbus, product->identifierByte));
+    product->setFont(FontVariant::FontAirbus);
 
     Dataref::getInstance()->monitorExistingDataref<float>("AirbusFBW/PanelBrightnessLevel", [product](float brightness) {
         uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? brightness * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/DUBrightness", [product](std::vector<float> brightness) {
-        if (brightness.size() < 8) {
+    // DUBrightness[6] is MCDU1, [7] MCDU2
+    size_t screen = side == FMCSide::FirstOfficer ? 7 : 6;
+    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/DUBrightness", [product, screen](std::vector<float> brightness) {
+        if (brightness.size() <= screen) {
             return;
         }
 
-        uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? brightness[6] * 255.0f : 0;
+        uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? brightness[screen] * 255.0f : 0;
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/DUBrightness");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
-    });
+    }, this);
 }
 
 TolissFMCProfile::~TolissFMCProfile() {
-    Dataref::getInstance()->unbind("AirbusFBW/PanelBrightnessLevel");
-    Dataref::getInstance()->unbind("AirbusFBW/DUBrightness");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
+    Dataref::getInstance()->unbind("AirbusFBW/PanelBrightnessLevel", this);
+    Dataref::getInstance()->unbind("AirbusFBW/DUBrightness", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
 }
 
 bool TolissFMCProfile::IsEligible() {
@@ -45,6 +83,14 @@ bool TolissFMCProfile::IsEligible() {
 }
 
 const std::vector<std::string> &TolissFMCProfile::displayDatarefs() const {
+    return sideDisplayDatarefs;
+}
+
+const std::vector<FMCButtonDef> &TolissFMCProfile::buttonDefs() const {
+    return sideButtonDefs;
+}
+
+const std::vector<std::string> &TolissFMCProfile::captainDisplayDatarefs() {
     static const std::vector<std::string> datarefs = {
         "AirbusFBW/MCDU1titleb",
         "AirbusFBW/MCDU1titleg",
@@ -175,13 +221,14 @@ const std::vector<std::string> &TolissFMCProfile::displayDatarefs() const {
         "AirbusFBW/MCDU1scont6y",
 
         "AirbusFBW/MCDU1spw", // scratchpad
-        "AirbusFBW/MCDU1spa"  // scratchpad
+        "AirbusFBW/MCDU1spa", // scratchpad
+        "AirbusFBW/MCDU1VertSlewKeys",
     };
 
     return datarefs;
 }
 
-const std::vector<FMCButtonDef> &TolissFMCProfile::buttonDefs() const {
+const std::vector<FMCButtonDef> &TolissFMCProfile::captainButtonDefs() {
     static const std::vector<FMCButtonDef> buttons = {
         {FMCKey::LSK1L, "AirbusFBW/MCDU1LSK1L"},
         {FMCKey::LSK2L, "AirbusFBW/MCDU1LSK2L"},
@@ -277,15 +324,15 @@ const std::map<char, FMCTextColor> &TolissFMCProfile::colorMap() const {
     return colMap;
 }
 
-void TolissFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void TolissFMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '#':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         case '<':
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_LEFT.begin(), FMCSpecialCharacter::ARROW_LEFT.end());
+                buffer->append(FMCSpecialCharacter::ARROW_LEFT);
             } else {
                 buffer->push_back(character);
             }
@@ -293,7 +340,7 @@ void TolissFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t charac
 
         case '>':
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_RIGHT.begin(), FMCSpecialCharacter::ARROW_RIGHT.end());
+                buffer->append(FMCSpecialCharacter::ARROW_RIGHT);
             } else {
                 buffer->push_back(character);
             }
@@ -301,24 +348,24 @@ void TolissFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t charac
 
         case 30: // Up arrow
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_UP.begin(), FMCSpecialCharacter::ARROW_UP.end());
+                buffer->append(FMCSpecialCharacter::ARROW_UP);
             }
             break;
 
         case 31: // Down arrow
             if (isFontSmall) {
-                buffer->insert(buffer->end(), FMCSpecialCharacter::ARROW_DOWN.begin(), FMCSpecialCharacter::ARROW_DOWN.end());
+                buffer->append(FMCSpecialCharacter::ARROW_DOWN);
             } else {
                 buffer->push_back(character);
             }
             break;
 
         case '`':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
 
         case '|':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::TRIANGLE.begin(), FMCSpecialCharacter::TRIANGLE.end());
+            buffer->append(FMCSpecialCharacter::TRIANGLE);
             break;
 
         default:
@@ -327,31 +374,33 @@ void TolissFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t charac
     }
 }
 
-void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    std::array<int, ProductFMC::PageBytesPerLine> spw_line{};
-    std::array<int, ProductFMC::PageBytesPerLine> spa_line{};
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
+FMCRowMask TolissFMCProfile::displayRowsForDataref(const std::string &ref) const {
+    // The slew arrows share the scratchpad line
+    if (ref == vertSlewKeysRef) {
+        return FMCScreen::rowMask(13);
+    }
 
-    auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
-        bool isScratchpad = (ref.size() >= 3 && (ref.substr(ref.size() - 3) == "spw" || ref.substr(ref.size() - 3) == "spa"));
+    return FMCAircraftProfile::displayRowsForDataref(ref);
+}
 
-        std::smatch match;
-        if (!std::regex_match(ref, match, datarefRegex) && !isScratchpad) {
-            continue;
-        }
+void TolissFMCProfile::updatePage(FMCScreen &screen) {
+    updateRows(screen, FMCScreen::AllRows);
+}
 
-        unsigned char mcduIndex = std::stoi(match[1]);
-        if (mcduIndex != 1) {
+void TolissFMCProfile::updateRows(FMCScreen &screen, FMCRowMask rows) {
+    std::array<int, ProductFMC::PageCharsPerLine> spw_line{};
+    std::array<int, ProductFMC::PageCharsPerLine> spa_line{};
+
+    auto datarefManager = Dataref::getInstance();
+    for (const auto &binding : displayBindings) {
+        if (!(rows & FMCScreen::rowMask(binding.row))) {
             continue;
         }
 
-        std::string type = match[3];
-        unsigned char line = match[4].str().empty() ? 0 : std::stoi(match[4]) * 2;
-        char color = match[6].str()[0];
-        bool fontSmall = match[2] == "s" || (type == "label" && match[5] != "L") || color == 's';
+        bool isScratchpad = binding.kind == FMCDisplayBindingKind::Scratchpad;
+        char color = binding.color;
 
-        std::string text = datarefManager->getCached<std::string>(ref.c_str());
+        std::string text = datarefManager->getCached<std::string>(binding.ref);
         if (text.empty()) {
             continue;
         }
@@ -405,25 +454,24 @@ void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
                 }
             }
 
-            if (type.find("title") != std::string::npos || type.find("stitle") != std::string::npos) {
-                product->writeLineToPage(page, 0, i, std::string(1, c), targetColor, fontSmall);
-            } else if (type.find("label") != std::string::npos) {
-                unsigned char lbl_line = (match[4].str().empty() ? 1 : std::stoi(match[4])) * 2 - 1;
-                product->writeLineToPage(page, lbl_line, i, std::string(1, c), targetColor, fontSmall);
-            } else if (type.find("cont") != std::string::npos || type.find("scont") != std::string::npos) {
-                product->writeLineToPage(page, line, i, std::string(1, c), targetColor, fontSmall);
-            } else if (isScratchpad) {
-                if (ref.size() >= 3 && ref.substr(ref.size() - 3) == "spw") {
+            if (!isScratchpad) {
+                screen.putChar(binding.row, i, c, targetColor, binding.fontSmall);
+            } else if (binding.color == 'w') {
+                if (i < ProductFMC::PageCharsPerLine) {
                     spw_line[i] = c;
-                } else {
-                    if (i <= 21) {
-                        spa_line[i] = c;
-                    }
+                }
+            } else {
+                if (i <= 21) {
+                    spa_line[i] = c;
                 }
             }
         }
     }
 
+    if (!(rows & FMCScreen::rowMask(13))) {
+        return;
+    }
+
     for (int i = 0; i < ProductFMC::PageCharsPerLine; ++i) {
         if (spw_line[i] == 0) {
             std::fill(spw_line.begin() + i, spw_line.end(), 0);
@@ -438,7 +486,7 @@ void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     }
 
     // Merge spw and spa into line 13
-    int vertSlewType = Dataref::getInstance()->getCached<int>("AirbusFBW/MCDU1VertSlewKeys");
+    int vertSlewType = Dataref::getInstance()->getCached<int>(vertSlewKeysRef.c_str());
     for (int i = 0; i < ProductFMC::PageCharsPerLine; ++i) {
         bool smallFont = false;
         char dispChar = ' ';
@@ -462,7 +510,7 @@ void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             smallFont = true;
         }
 
-        product->writeLineToPage(page, 13, i, std::string(1, dispChar), dispColor, smallFont);
+        screen.putChar(13, i, dispChar, dispColor, smallFont);
     }
 }
 
@@ -3,11 +3,14 @@
 
 #include "fmc-aircraft-profile.h"
 
-#include <regex>
-
 class TolissFMCProfile : public FMCAircraftProfile {
     private:
-        std::regex datarefRegex;
+        std::vector<std::string> sideDisplayDatarefs;
+        std::vector<FMCButtonDef> sideButtonDefs;
+        std::string vertSlewKeysRef;
+
+        static const std::vector<std::string> &captainDisplayDatarefs();
+        static const std::vector<FMCButtonDef> &captainButtonDefs();
 
     public:
         TolissFMCProfile(ProductFMC *product);
@@ -17,8 +20,10 @@ class TolissFMCProfile : public FMCAircraftProfile {
         const std::vector<std::string> &displayDatarefs() const override;
         const std::vector<FMCButtonDef> &buttonDefs() const override;
         const std::map<char, FMCTextColor> &colorMap() const override;
-        void mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) override;
-        void updatePage(std::vector<std::vector<char>> &page) override;
+        void mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) override;
+        FMCRowMask displayRowsForDataref(const std::string &ref) const override;
+        void updatePage(FMCScreen &screen) override;
+        void updateRows(FMCScreen &screen, FMCRowMask rows) override;
         void buttonPressed(const FMCButtonDef *button, XPLMCommandPhase phase) override;
 };
 
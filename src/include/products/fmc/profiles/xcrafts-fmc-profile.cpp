@@ -18,23 +18,23 @@ XCraftsFMCProfile::XCraftsFMCProfile(ProductFMC *product) :
     datarefRegex = std::regex("XCrafts/FMS/CDU_1_([0-9]{2}|ScratchPad)");
 
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::FontXCrafts, product->identifierByte));
+    product->setFont(FontVariant::FontXCrafts);
 
     Dataref::getInstance()->monitorExistingDataref<float>("XCrafts/FMS/CDU1_brt", [product](float rawBrightness) {
         bool poweredOn = Dataref::getInstance()->getCached<bool>("XCrafts/FMS/power_stat");
         uint8_t brightness = poweredOn ? rawBrightness * 255.0f : 0;
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, brightness);
         product->setLedBrightness(FMCLed::BACKLIGHT, brightness);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("XCrafts/FMS/power_stat", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("XCrafts/FMS/CDU1_brt");
-    });
+    }, this);
 }
 
 XCraftsFMCProfile::~XCraftsFMCProfile() {
-    Dataref::getInstance()->unbind("XCrafts/FMS/CDU1_brt");
-    Dataref::getInstance()->unbind("XCrafts/FMS/power_stat");
+    Dataref::getInstance()->unbind("XCrafts/FMS/CDU1_brt", this);
+    Dataref::getInstance()->unbind("XCrafts/FMS/power_stat", this);
 }
 
 bool XCraftsFMCProfile::IsEligible() {
@@ -177,10 +177,10 @@ const std::map<char, FMCTextColor> &XCraftsFMCProfile::colorMap() const {
     return colors;
 }
 
-void XCraftsFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void XCraftsFMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '?':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         default:
@@ -189,9 +189,7 @@ void XCraftsFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t chara
     }
 }
 
-void XCraftsFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
-
+void XCraftsFMCProfile::updatePage(FMCScreen &screen) {
     auto datarefManager = Dataref::getInstance();
 
     int dataCount = datarefManager->getCached<int>("XCrafts/FMS/data_count1");
@@ -243,7 +241,7 @@ void XCraftsFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
 
                 int displayCol = colIndex + (j - textStartIndex);
                 bool isSmallFont = fontStyle == XCraftsFMCFontStyle::Small || fontStyle == XCraftsFMCFontStyle::SmallReversed || fontStyle == XCraftsFMCFontStyle::SmallReversedBox;
-                product->writeLineToPage(page, lineIndex, displayCol, std::string(1, (char) c), colorCode, isSmallFont);
+                screen.putChar(lineIndex, displayCol, (char) c, colorCode, isSmallFont);
             }
         }
     }
@@ -255,7 +253,7 @@ void XCraftsFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             if (c == 0x00 || c == '|') {
                 break;
             }
-            product->writeLineToPage(page, 13, i, std::string(1, (char) c), 0, false);
+            screen.putChar(13, i, (char) c, 0, false);
         }
     }
 }
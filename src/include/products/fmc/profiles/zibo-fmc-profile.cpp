@@ -9,23 +9,56 @@
 #include <cfloat>
 #include <cmath>
 #include <cstring>
+#include <regex>
 
 ZiboFMCProfile::ZiboFMCProfile(ProductFMC *product) :
     FMCAircraftProfile(product) {
-    datarefRegex = std::regex("laminar/B738/fmc1/Line([0-9]{2})_([A-Z]+)");
+    followUnitSide();
+    sideDisplayDatarefs = forSide(captainDisplayDatarefs(), "fmc1", "fmc2");
+    sideButtonDefs = forSide(captainButtonDefs(), "fmc1", "fmc2");
+
+    std::regex datarefRegex("laminar/B738/fmc[12]/Line([0-9]{2})_([A-Z]+)");
+    for (const auto &ref : displayDatarefs()) {
+        if (ref.ends_with("/Line_entry") || ref.ends_with("/Line_entry_I")) {
+            char color = ref.ends_with("_I") ? 'I' : 'W';
+            displayBindings.push_back({ref.c_str(), FMCDisplayBindingKind::Scratchpad, 13, color, false});
+            continue;
+        }
+
+        std::smatch match;
+        if (!std::regex_match(ref, match, datarefRegex)) {
+            continue;
+        }
+
+        unsigned char lineNum = std::stoi(match[1]);
+        std::string colorStr = match[2];
+
+        // For double-letter codes like "GX", "LX", use first letter for color
+        char color = colorStr[0];
+        bool fontSmall = color == 'X' || color == 'S';
+
+        if (colorStr.back() == 'X') {
+            // X datarefs go to odd lines (labels)
+            displayBindings.push_back({ref.c_str(), FMCDisplayBindingKind::Label, (unsigned char) (lineNum * 2 - 1), color, fontSmall});
+        } else {
+            FMCDisplayBindingKind kind = lineNum == 0 ? FMCDisplayBindingKind::Title : FMCDisplayBindingKind::Content;
+            displayBindings.push_back({ref.c_str(), kind, (unsigned char) (lineNum * 2), color, fontSmall});
+        }
+    }
 
     product->setAllLedsEnabled(false);
-    product->setFont(Font::GlyphData(FontVariant::Font737, product->identifierByte));
+    product->setFont(FontVariant::Font737);
 
-    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/electric/instrument_brightness", [product](std::vector<float> screenBrightness) {
-        if (screenBrightness.size() < 11) {
+    // brightness[10] is the fmc1 screen, brightness[11] the fmc2 one
+    size_t screen = side == FMCSide::FirstOfficer ? 11 : 10;
+    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/electric/instrument_brightness", [product, screen](std::vector<float> screenBrightness) {
+        if (screenBrightness.size() <= screen) {
             return;
         }
 
-        // brightness[11] is fmc2 screen
-        uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? screenBrightness[10] * 255.0f : 0;
+        uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? screenBrightness[screen] * 255.0f : 0;
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/electric/panel_brightness", [product](std::vector<float> panelBrightness) {
         if (panelBrightness.size() < 4) {
@@ -34,30 +67,33 @@ ZiboFMCProfile::ZiboFMCProfile(ProductFMC *product) :
 
         uint8_t target = Dataref::getInstance()->get<bool>("sim/cockpit/electrical/avionics_on") ? panelBrightness[3] * 255.0f : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/instrument_brightness");
-    });
+    }, this);
+
+    messageLampRef = forSide("laminar/B738/fmc/fmc_message", "laminar/B738/fmc/fmc_message2");
+    execLampRef = forSide("laminar/B738/indicators/fmc_exec_lights", "laminar/B738/indicators/fmc_exec_lights_fo");
 
-    Dataref::getInstance()->monitorExistingDataref<bool>("laminar/B738/fmc/fmc_message", [product](bool enabled) {
+    Dataref::getInstance()->monitorExistingDataref<bool>(messageLampRef.c_str(), [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_MSG, enabled ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_MCDU, enabled ? 1 : 0);
-    });
+    }, this);
 
-    Dataref::getInstance()->monitorExistingDataref<bool>("laminar/B738/indicators/fmc_exec_lights", [product](bool enabled) {
+    Dataref::getInstance()->monitorExistingDataref<bool>(execLampRef.c_str(), [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_EXEC, enabled ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_RDY, enabled ? 1 : 0);
-    });
+    }, this);
 }
 
 ZiboFMCProfile::~ZiboFMCProfile() {
-    Dataref::getInstance()->unbind("laminar/B738/electric/instrument_brightness");
-    Dataref::getInstance()->unbind("laminar/B738/electric/panel_brightness");
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
-    Dataref::getInstance()->unbind("laminar/B738/fmc/fmc_message");
-    Dataref::getInstance()->unbind("laminar/B738/indicators/fmc_exec_lights");
+    Dataref::getInstance()->unbind("laminar/B738/electric/instrument_brightness", this);
+    Dataref::getInstance()->unbind("laminar/B738/electric/panel_brightness", this);
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
+    Dataref::getInstance()->unbind(messageLampRef.c_str(), this);
+    Dataref::getInstance()->unbind(execLampRef.c_str(), this);
 }
 
 bool ZiboFMCProfile::IsEligible() {
@@ -65,6 +101,14 @@ bool ZiboFMCProfile::IsEligible() {
 }
 
 const std::vector<std::string> &ZiboFMCProfile::displayDatarefs() const {
+    return sideDisplayDatarefs;
+}
+
+const std::vector<FMCButtonDef> &ZiboFMCProfile::buttonDefs() const {
+    return sideButtonDefs;
+}
+
+const std::vector<std::string> &ZiboFMCProfile::captainDisplayDatarefs() {
     static const std::vector<std::string> datarefs = {
         "laminar/B738/fmc1/Line00_C",
         "laminar/B738/fmc1/Line00_G",
@@ -134,7 +178,7 @@ const std::vector<std::string> &ZiboFMCProfile::displayDatarefs() const {
     return datarefs;
 }
 
-const std::vector<FMCButtonDef> &ZiboFMCProfile::buttonDefs() const {
+const std::vector<FMCButtonDef> &ZiboFMCProfile::captainButtonDefs() {
     static const std::vector<FMCButtonDef> buttons = {
         {FMCKey::LSK1L, "laminar/B738/button/fmc1_1L"},
         {FMCKey::LSK2L, "laminar/B738/button/fmc1_2L"},
@@ -226,14 +270,14 @@ const std::map<char, FMCTextColor> &ZiboFMCProfile::colorMap() const {
     return colMap;
 }
 
-void ZiboFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) {
+void ZiboFMCProfile::mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) {
     switch (character) {
         case '*':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::OUTLINED_SQUARE.begin(), FMCSpecialCharacter::OUTLINED_SQUARE.end());
+            buffer->append(FMCSpecialCharacter::OUTLINED_SQUARE);
             break;
 
         case '`':
-            buffer->insert(buffer->end(), FMCSpecialCharacter::DEGREES.begin(), FMCSpecialCharacter::DEGREES.end());
+            buffer->append(FMCSpecialCharacter::DEGREES);
             break;
 
         default:
@@ -242,61 +286,26 @@ void ZiboFMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t characte
     }
 }
 
-void ZiboFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
-    page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
+void ZiboFMCProfile::updatePage(FMCScreen &screen) {
+    updateRows(screen, FMCScreen::AllRows);
+}
 
+void ZiboFMCProfile::updateRows(FMCScreen &screen, FMCRowMask rows) {
     auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
-        std::string text = datarefManager->getCached<std::string>(ref.c_str());
-
-        // Handle scratchpad datarefs specially
-        if (ref == "laminar/B738/fmc1/Line_entry" || ref == "laminar/B738/fmc1/Line_entry_I") {
-            if (!text.empty()) {
-                char color = (ref == "laminar/B738/fmc1/Line_entry_I") ? 'I' : 'W';
-
-                // Store scratchpad text for later display on line 13
-                for (int i = 0; i < text.size() && i < ProductFMC::PageCharsPerLine; ++i) {
-                    char c = text[i];
-                    if (c == 0x00) {
-                        break; // End of string
-                    }
-                    if (c != 0x20) { // Skip spaces
-                        product->writeLineToPage(page, 13, i, std::string(1, c), color, false);
-                    }
-                }
-            }
-            continue;
-        }
-
-        std::smatch match;
-        if (!std::regex_match(ref, match, datarefRegex)) {
-            continue;
-        }
-
-        unsigned char lineNum = std::stoi(match[1]);
-        std::string colorStr = match[2];
-
-        // For double-letter codes like "GX", "LX", use first letter for color
-        char color = colorStr[0];
-
-        unsigned char displayLine = lineNum * 2;
-        bool fontSmall = color == 'X' || color == 'S';
-        if (colorStr.back() == 'X') {
-            displayLine -= 1; // X datarefs go to odd lines (labels)
-        }
-
-        if (text.empty()) {
+    for (const auto &binding : displayBindings) {
+        if (!(rows & FMCScreen::rowMask(binding.row))) {
             continue;
         }
 
+        std::string text = datarefManager->getCached<std::string>(binding.ref);
         for (int i = 0; i < text.size() && i < ProductFMC::PageCharsPerLine; ++i) {
             char c = text[i];
             if (c == 0x00) {
-                break;
+                break; // End of string
             }
 
-            if (c != 0x20) {
-                product->writeLineToPage(page, displayLine, i, std::string(1, c), color, fontSmall);
+            if (c != 0x20) { // Skip spaces
+                screen.putChar(binding.row, i, c, binding.color, binding.fontSmall);
             }
         }
     }
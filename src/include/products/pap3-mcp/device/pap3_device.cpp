@@ -7,6 +7,7 @@
 #include "../menu/pap3_menu.h"
 
 #include "inputs.h"
+#include "threadpolicy.h"
 #include "usbcontroller.h"
 
 #include <XPLMProcessing.h>
@@ -79,16 +80,16 @@ PAP3Device::PAP3Device(HIDDeviceHandle hidDevice,
                        std::uint16_t  vendorId,
                        std::uint16_t  productId,
                        const std::string& vendorName,
-                       const std::string& productName)
-: USBDevice(hidDevice, vendorId, productId, vendorName, productName)
+                       const std::string& productName,
+                       const std::string& identity)
+: USBDevice(hidDevice, vendorId, productId, vendorName, productName, identity)
 , _seq(5)
 {
     ensureWriterInstalled();
     debug_force("PAP3Device constructed - vendorId: 0x%04X, productId: 0x%04X\n", vendorId, productId);
 
-    if (USBDevice::connect()) {
+    if (connect()) {
         debug_force("PAP3Device connected\n");
-        runStartupSequence();
     }
 }
 
@@ -100,6 +101,32 @@ PAP3Device::~PAP3Device()
     _inputs.onLightSensor = nullptr;
     _inputs.onRaw         = nullptr;
 
+    disconnect();
+}
+
+bool PAP3Device::connect()
+{
+    if (!USBDevice::connect()) {
+        return false;
+    }
+
+    // The unit may have lost power meanwhile, nothing it showed before is assumed
+    {
+        std::lock_guard<std::mutex> lk(_ioMx);
+        _ioQueue.clear();
+    }
+    _sentLedBitmap = 0;
+    std::fill(std::begin(_sentDimming), std::end(_sentDimming), 255);
+    _sentSolenoid = false;
+    _sentLcd32.clear();
+
+    _startupState = StartupState::InitFrames;
+    advanceStartup();
+    return true;
+}
+
+void PAP3Device::disconnect()
+{
     if (_ioRunning.exchange(false)) {
         _ioCv.notify_all();
         if (_ioThread.joinable()) _ioThread.join();
@@ -129,16 +156,51 @@ void PAP3Device::allLedsOff() {
     for (auto id : kAllLedIds) qSetLed(id, false);
 }
 
-bool PAP3Device::waitForInitialSwitchSnapshot(std::chrono::milliseconds timeout)
+// -----------------------------------------------------------------------------
+// Startup state machine (lisible, cohérent)
+// -----------------------------------------------------------------------------
+void PAP3Device::advanceStartup()
 {
-    std::unique_lock<std::mutex> lk(_snapshotMx);
-    return _snapshotCv.wait_for(lk, timeout, [this]{ return _haveInitialReport; });
+    switch (_startupState) {
+        case StartupState::InitFrames:
+            sendInitFrames();
+            requestSnapshot();
+            break;
+
+        case StartupState::AwaitingSnapshot:
+            if (!_haveInitialReport) {
+                if (std::chrono::steady_clock::now() < _snapshotDeadline) return;
+                debug_force("[PAP3] WARNING: no initial switch snapshot within timeout -> continuing\n");
+            }
+            _startupState = StartupState::ProfileSync;
+            [[fallthrough]];
+
+        case StartupState::ProfileSync:
+            attachProfile();
+            _startupState = StartupState::Live;
+            debug_force("[PAP3] Startup sequence complete - profile %s\n", _profile ? "ready" : "not found");
+            break;
+
+        case StartupState::Live:
+            break;
+    }
 }
 
-// -----------------------------------------------------------------------------
-// Startup sequence (lisible, cohérent)
-// -----------------------------------------------------------------------------
-void PAP3Device::runStartupSequence()
+/// Demande l'état courant des switches au lieu d'attendre le premier rapport spontané.
+/// La réponse arrive par didReceiveData() comme n'importe quel rapport d'entrée.
+void PAP3Device::requestSnapshot()
+{
+    _haveInitialReport = false;
+    _initialReport.clear();
+    _snapshotDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(1000);
+    _startupState = StartupState::AwaitingSnapshot;
+
+    if (!requestInputReport(Inputs::kHeader)) {
+        debug_force("[PAP3] Input report request not supported -> waiting for the first report\n");
+    }
+}
+
+void PAP3Device::sendInitFrames()
 {
     // 1) LEDs OFF
     allLedsOff();
@@ -183,16 +245,19 @@ void PAP3Device::runStartupSequence()
     setupInputCallbacks();
     if (!_ioRunning.load()) {
         _ioRunning.store(true);
-        _ioThread = std::thread([this]{ this->ioThreadMain(); });
+        _ioThread = std::thread([this]{
+            ThreadPolicy::Apply(ThreadRole::DeviceIO);
+            this->ioThreadMain();
+        });
     }
 
-    // 6) Attendre une 1re photo des switches (snapshot HID brut)
-    const bool gotSnapshot = waitForInitialSwitchSnapshot(std::chrono::milliseconds(1000));
-    if (!gotSnapshot) {
-        debug_force("[PAP3] WARNING: no initial switch snapshot within timeout -> continuing\n");
-    }
+}
 
-    // 7) Détecter + démarrer le profil
+// -----------------------------------------------------------------------------
+// Profile attach / detach (the USB connection outlives the aircraft)
+// -----------------------------------------------------------------------------
+void PAP3Device::attachProfile()
+{
     _profile = ProfileFactory::detect();
     if (_profile) {
         profileReady = true;
@@ -229,11 +294,46 @@ void PAP3Device::runStartupSequence()
         profileReady = true;
     }
     
-    debug_force("[PAP3] Startup sequence complete - profile %s\n", _profile ? "ready" : "not found");
-
     updatePower(); // met à jour dimming + solénoïde (selon power mask)
 }
 
+void PAP3Device::unloadProfile()
+{
+    profileReady = false;
+
+    // Le prochain avion repart d'une photo fraîche des switches. The request blocks on the device,
+    // so one that isn't healthy gets the profile without it and syncs on its next input report;
+    // a lost one starts over from connect() anyway.
+    if (_startupState == StartupState::Live) {
+        if (health == USBDeviceHealth::Healthy) {
+            requestSnapshot();
+        } else {
+            _haveInitialReport = false;
+            _initialReport.clear();
+            _startupState = StartupState::ProfileSync;
+        }
+    }
+
+    if (!_profile) return;
+
+    _profile.reset();
+
+    // Cancel any pending A/T pulse that belongs to the old aircraft
+    if (_atPulseFL) {
+        XPLMDestroyFlightLoop(_atPulseFL);
+        _atPulseFL = nullptr;
+    }
+    _atPulsePending = false;
+    _haveSimAtSample = false;
+    _pendingAtArmDrop = false;
+    _pendingAtArmDropRefusal = false;
+    _didStartupSync = false;
+
+    allLedsOff();
+    qLcdPayload(std::vector<std::uint8_t>(32, 0x00));
+    updatePower();
+}
+
 // -----------------------------------------------------------------------------
 // Public helpers (transport delegates)
 // -----------------------------------------------------------------------------
@@ -263,13 +363,8 @@ void PAP3Device::onHidInputReport(const std::uint8_t* report, int len)
 {
     // 1) Capture one-shot du snapshot initial (brut)
     if (!_haveInitialReport && report && len > 0) {
-        std::vector<std::uint8_t> freshSnapshot(report, report + len);
-        {
-            std::lock_guard<std::mutex> lk(_snapshotMx);
-            _initialReport = std::move(freshSnapshot);
-            _haveInitialReport = true;
-        }
-        _snapshotCv.notify_all();
+        _initialReport.assign(report, report + len);
+        _haveInitialReport = true;
         debug_force("[PAP3] Captured initial switch snapshot (%d bytes)\n", len);
         if (_pendingInitialHardwareSync && _profile) {
             debug_force("[PAP3] Applying captured hardware snapshot to sim (deferred)\n");
@@ -517,6 +612,7 @@ void PAP3Device::applyState(const aircraft::State& st)
 // -----------------------------------------------------------------------------
 void PAP3Device::update() {
     this->USBDevice::update();
+    advanceStartup();
     if (_profile) _profile->tick();
 }
 
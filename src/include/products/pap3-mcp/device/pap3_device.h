@@ -9,6 +9,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
 #include <unordered_map>
 
 #include <XPLMProcessing.h>
@@ -34,7 +35,8 @@ public:
                uint16_t vendorId,
                uint16_t productId,
                const std::string& vendorName,
-               const std::string& productName);
+               const std::string& productName,
+               const std::string& identity);
     ~PAP3Device() override;
 
     // LCD ops
@@ -52,7 +54,11 @@ public:
     // Expose current sequence
     std::uint8_t currentSeq() const noexcept { return _seq; }
 
+    // Also used to reconnect, connect() starts the boot sequence over
+    bool connect() override;
+    void disconnect() override;
     void update() override;
+    void unloadProfile() override;
 
     // Optional entry if a lower layer receives HID reports
     void onHidInputReport(const uint8_t* report, int len);
@@ -65,8 +71,17 @@ private:
     // Writer bridge
     void ensureWriterInstalled() const;
 
-    // Boot
-    void runStartupSequence();
+    // Boot, advanced from update() so nothing waits on the sim thread
+    enum class StartupState : std::uint8_t {
+        InitFrames,       ///< LEDs off, LCD init, default dimming
+        AwaitingSnapshot, ///< Input report requested, waiting for it (or the timeout)
+        ProfileSync,      ///< Detect the profile and align the sim on the snapshot
+        Live
+    };
+    void advanceStartup();
+    void sendInitFrames();
+    void requestSnapshot();
+    void attachProfile();
     void allLedsOff();
 
     // Illumination & power
@@ -74,7 +89,6 @@ private:
 
     // Inputs wiring
     void setupInputCallbacks();
-    bool waitForInitialSwitchSnapshot(std::chrono::milliseconds timeout);
 
     // Worker queue
     struct IoCmd {
@@ -123,8 +137,8 @@ private:
     pap3::device::Inputs _inputs;
 
     // Snapshot boot
-    std::mutex _snapshotMx;
-    std::condition_variable _snapshotCv;
+    StartupState _startupState{StartupState::InitFrames};
+    std::chrono::steady_clock::time_point _snapshotDeadline;
     std::vector<std::uint8_t> _initialReport;
     bool _haveInitialReport{false};
     bool _didStartupSync{false};
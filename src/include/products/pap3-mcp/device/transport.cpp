@@ -50,8 +50,7 @@ static inline void bumpSeq(uint8_t& seq) noexcept
 bool writerUsbWriteData(DevicePtr dev, const uint8_t* data, std::size_t len)
 {
     if (!dev || !data || len == 0) return false;
-    std::vector<uint8_t> buffer(data, data + len);
-    return dev->writeData(std::move(buffer));
+    return dev->writeReport({data, len});
 }
 
 void setWriter(WriterFn fn) { s_writer = fn; }
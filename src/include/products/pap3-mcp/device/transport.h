@@ -36,7 +36,7 @@ using WriterFn = bool(*)(DevicePtr, const uint8_t*, std::size_t);
 // Install the concrete writer (call once after the HID device is opened).
 void setWriter(WriterFn fn);
 
-// Default writer for macOS HID: prefixes Report ID (0x00 by default) and calls USBDevice::writeData(std::vector<uint8_t>).
+// Default writer: hands the caller's buffer straight to USBDevice::writeReport(std::span<const uint8_t>) without copying.
 bool writerUsbWriteData(DevicePtr dev, const uint8_t* data, std::size_t len);
 
 // -----------------------------------------------------------------------------
@@ -4,10 +4,11 @@
 #include "dataref.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 
-ProductUrsaMinorJoystick::ProductUrsaMinorJoystick(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) :
-    USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
+ProductUrsaMinorJoystick::ProductUrsaMinorJoystick(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity) :
+    USBDevice(hidDevice, vendorId, productId, vendorName, productName, identity) {
     connect();
 }
 
@@ -31,14 +32,24 @@ bool ProductUrsaMinorJoystick::connect() {
 }
 
 void ProductUrsaMinorJoystick::disconnect() {
+    unloadProfile();
+
+    USBDevice::disconnect();
+}
+
+void ProductUrsaMinorJoystick::unloadProfile() {
     setLedBrightness(0);
     setVibration(0);
+    lastVibration = 0;
 
-    USBDevice::disconnect();
+    // Also reached from disconnect() on a reconnect worker, after the main thread already unbound these
+    if (!didInitializeDatarefs) {
+        return;
+    }
 
-    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on");
-    Dataref::getInstance()->unbind("AirbusFBW/PanelBrightnessLevel");
-    Dataref::getInstance()->unbind("sim/flightmodel/failures/onground_any");
+    Dataref::getInstance()->unbind("sim/cockpit/electrical/avionics_on", this);
+    Dataref::getInstance()->unbind("AirbusFBW/PanelBrightnessLevel", this);
+    Dataref::getInstance()->unbind("sim/flightmodel/failures/onground_any", this);
     didInitializeDatarefs = false;
 }
 
@@ -74,11 +85,13 @@ void ProductUrsaMinorJoystick::update() {
 }
 
 bool ProductUrsaMinorJoystick::setVibration(uint8_t vibration) {
-    return writeData({0x02, 7, 191, 0, 0, 3, 0x49, 0, vibration, 0, 0, 0, 0, 0});
+    const std::array<uint8_t, 14> report = {0x02, 7, 191, 0, 0, 3, 0x49, 0, vibration, 0, 0, 0, 0, 0};
+    return writeReport(report);
 }
 
 bool ProductUrsaMinorJoystick::setLedBrightness(uint8_t brightness) {
-    return writeData({0x02, 0x20, 0xbb, 0, 0, 3, 0x49, 0, brightness, 0, 0, 0, 0, 0});
+    const std::array<uint8_t, 14> report = {0x02, 0x20, 0xbb, 0, 0, 3, 0x49, 0, brightness, 0, 0, 0, 0, 0};
+    return writeReport(report);
 }
 
 void ProductUrsaMinorJoystick::initializeDatarefs() {
@@ -96,9 +109,9 @@ void ProductUrsaMinorJoystick::initializeDatarefs() {
         if (!hasPower) {
             setVibration(0);
         }
-    });
+    }, this);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
-    });
+    }, this);
 }
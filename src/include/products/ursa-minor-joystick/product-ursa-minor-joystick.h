@@ -10,13 +10,14 @@ class ProductUrsaMinorJoystick : public USBDevice {
         float lastGForce;
 
     public:
-        ProductUrsaMinorJoystick(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName);
+        ProductUrsaMinorJoystick(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity);
         ~ProductUrsaMinorJoystick();
 
         const char *classIdentifier() override;
         bool connect() override;
         void disconnect() override;
         void update() override;
+        void unloadProfile() override;
 
         bool setVibration(uint8_t vibration);
         bool setLedBrightness(uint8_t brightness);
@@ -67,7 +67,8 @@ void Dataref::createDataref(const char *ref, T *value, bool writable, DatarefSho
                 }
             }
             return false;
-        }}};
+        }},
+        {nullptr}};
 
     if constexpr ((std::is_same_v<T, int>) || (std::is_same_v<T, bool>) ) {
         handle = XPLMRegisterDataAccessor(ref, xplmType_Int, writable ? 1 : 0, [](void *inRefcon) -> int {
@@ -186,15 +187,15 @@ void Dataref::createDataref(const char *ref, T *value, bool writable, DatarefSho
     boundRefs[ref].handle = handle;
 }
 
-template void Dataref::monitorExistingDataref<int>(const char *ref, DatarefMonitorChangedCallback<int> changeCallback);
-template void Dataref::monitorExistingDataref<bool>(const char *ref, DatarefMonitorChangedCallback<bool> changeCallback);
-template void Dataref::monitorExistingDataref<float>(const char *ref, DatarefMonitorChangedCallback<float> changeCallback);
-template void Dataref::monitorExistingDataref<double>(const char *ref, DatarefMonitorChangedCallback<double> changeCallback);
-template void Dataref::monitorExistingDataref<std::string>(const char *ref, DatarefMonitorChangedCallback<std::string> changeCallback);
-template void Dataref::monitorExistingDataref<std::vector<float>>(const char *ref, DatarefMonitorChangedCallback<std::vector<float>> changeCallback);
+template void Dataref::monitorExistingDataref<int>(const char *ref, DatarefMonitorChangedCallback<int> changeCallback, const void *owner);
+template void Dataref::monitorExistingDataref<bool>(const char *ref, DatarefMonitorChangedCallback<bool> changeCallback, const void *owner);
+template void Dataref::monitorExistingDataref<float>(const char *ref, DatarefMonitorChangedCallback<float> changeCallback, const void *owner);
+template void Dataref::monitorExistingDataref<double>(const char *ref, DatarefMonitorChangedCallback<double> changeCallback, const void *owner);
+template void Dataref::monitorExistingDataref<std::string>(const char *ref, DatarefMonitorChangedCallback<std::string> changeCallback, const void *owner);
+template void Dataref::monitorExistingDataref<std::vector<float>>(const char *ref, DatarefMonitorChangedCallback<std::vector<float>> changeCallback, const void *owner);
 
 template<typename T>
-void Dataref::monitorExistingDataref(const char *ref, DatarefMonitorChangedCallback<T> changeCallback) {
+void Dataref::monitorExistingDataref(const char *ref, DatarefMonitorChangedCallback<T> changeCallback, const void *owner) {
     if constexpr (std::is_same_v<T, std::string>) {
         set<T>(ref, "", true);
     } else if constexpr (std::is_same_v<T, std::vector<float>>) {
@@ -225,11 +226,13 @@ void Dataref::monitorExistingDataref(const char *ref, DatarefMonitorChangedCallb
 
     if (boundRefs.find(ref) != boundRefs.end()) {
         boundRefs[ref].changeCallbacks.push_back(callback);
+        boundRefs[ref].callbackOwners.push_back(owner);
     } else {
         boundRefs[ref] = {
             0,
             nullptr,
-            {callback}};
+            {callback},
+            {owner}};
     }
 }
 
@@ -245,8 +248,22 @@ void Dataref::destroyAllBindings() {
     boundCommands.clear();
 }
 
-void Dataref::unbind(const char *ref) {
+void Dataref::unbind(const char *ref, const void *owner) {
     auto it = boundRefs.find(ref);
+    if (it != boundRefs.end() && owner) {
+        BoundRef &bound = it->second;
+        for (size_t i = bound.callbackOwners.size(); i-- > 0;) {
+            if (bound.callbackOwners[i] == owner) {
+                bound.changeCallbacks.erase(bound.changeCallbacks.begin() + i);
+                bound.callbackOwners.erase(bound.callbackOwners.begin() + i);
+            }
+        }
+
+        if (!bound.changeCallbacks.empty()) {
+            return;
+        }
+    }
+
     if (it != boundRefs.end()) {
         if (it->second.handle) {
             XPLMUnregisterDataAccessor(it->second.handle);
@@ -371,6 +388,27 @@ T Dataref::getCached(const char *ref) {
     return std::get<T>(it->second.value);
 }
 
+template std::span<const int> Dataref::getCachedSpan<int>(const char *ref);
+template std::span<const float> Dataref::getCachedSpan<float>(const char *ref);
+template std::span<const unsigned char> Dataref::getCachedSpan<unsigned char>(const char *ref);
+
+template<typename T>
+std::span<const T> Dataref::getCachedSpan(const char *ref) {
+    auto it = cachedValues.find(ref);
+    if (it == cachedValues.end()) {
+        cachedValues[ref] = {
+            .value = get<std::vector<T>>(ref),
+            .lastUpdateCycleNumber = XPLMGetCycleNumber()};
+        it = cachedValues.find(ref);
+    }
+
+    if (!std::holds_alternative<std::vector<T>>(it->second.value)) {
+        return {};
+    }
+
+    return std::get<std::vector<T>>(it->second.value);
+}
+
 template float Dataref::get<float>(const char *ref);
 template double Dataref::get<double>(const char *ref);
 template int Dataref::get<int>(const char *ref);
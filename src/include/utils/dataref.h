@@ -2,9 +2,11 @@
 #define DATAREF_H
 
 #include <functional>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 #include <XPLMDataAccess.h>
 #include <XPLMUtilities.h>
 
@@ -18,6 +20,7 @@ struct BoundRef {
         XPLMDataRef handle;
         void *valuePointer;
         std::vector<DatarefShouldChangeCallback<DataRefValueType>> changeCallbacks;
+        std::vector<const void *> callbackOwners; // Who added each of changeCallbacks, see unbind()
 };
 
 typedef std::function<void(XPLMCommandPhase inPhase)> CommandExecutedCallback;
@@ -46,13 +49,15 @@ class Dataref {
     public:
         static Dataref *getInstance();
 
+        // Several devices may watch the same dataref, each passing itself as owner
         template<typename T>
-        void monitorExistingDataref(const char *ref, DatarefMonitorChangedCallback<T> callback);
+        void monitorExistingDataref(const char *ref, DatarefMonitorChangedCallback<T> callback, const void *owner = nullptr);
         template<typename T>
         void createDataref(const char *ref, T *value, bool writable = false, DatarefShouldChangeCallback<T> changeCallback = nullptr);
         void bindExistingCommand(const char *command, CommandExecutedCallback callback);
         void createCommand(const char *command, const char *description, CommandExecutedCallback callback);
-        void unbind(const char *ref);
+        // With an owner only what it bound goes, the dataref stays bound while others still watch it
+        void unbind(const char *ref, const void *owner = nullptr);
         void destroyAllBindings();
         int _commandCallback(XPLMCommandRef inCommand, XPLMCommandPhase inPhase, void *inRefcon);
 
@@ -62,6 +67,9 @@ class Dataref {
         int getCachedLastUpdate(const char *ref);
         template<typename T>
         T getCached(const char *ref);
+        // Array datarefs without the copy: points into the cache, so it is only valid until the next update(), set() or clearCache()
+        template<typename T>
+        std::span<const T> getCachedSpan(const char *ref);
         template<typename T>
         T get(const char *ref);
         template<typename T>
@@ -0,0 +1,183 @@
+#include "threadpolicy.h"
+
+#include "appstate.h"
+#include "config.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <XPLMUtilities.h>
+
+#if APL
+#include <pthread.h>
+#include <pthread/qos.h>
+#elif IBM
+#include <windows.h>
+#elif LIN
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    struct RoleSettings {
+            const char *name; // Kept under 16 characters, the Linux limit
+            ThreadPriority priority;
+    };
+
+    constexpr uint64_t affinityMask = THREAD_AFFINITY_MASK;
+
+    std::mutex appliedMutex;
+    std::map<std::string, std::string> appliedPolicies;
+
+    RoleSettings settingsForRole(ThreadRole role) {
+        switch (role) {
+            case ThreadRole::DeviceInput:
+                return {"ww-input", static_cast<ThreadPriority>(THREAD_PRIORITY_DEVICE_IO)};
+            case ThreadRole::DeviceOutput:
+                return {"ww-output", static_cast<ThreadPriority>(THREAD_PRIORITY_DEVICE_IO)};
+            case ThreadRole::DeviceIO:
+                return {"ww-device-io", static_cast<ThreadPriority>(THREAD_PRIORITY_DEVICE_IO)};
+            case ThreadRole::DeviceMonitor:
+                return {"ww-monitor", static_cast<ThreadPriority>(THREAD_PRIORITY_BACKGROUND)};
+            case ThreadRole::DeviceBringUp:
+                return {"ww-bringup", static_cast<ThreadPriority>(THREAD_PRIORITY_BACKGROUND)};
+            case ThreadRole::CaptureReplay:
+                return {"ww-replay", static_cast<ThreadPriority>(THREAD_PRIORITY_DEVICE_IO)};
+        }
+
+        return {"ww-thread", ThreadPriority::Normal};
+    }
+
+    const char *priorityName(ThreadPriority priority) {
+        switch (priority) {
+            case ThreadPriority::Normal:
+                return "normal";
+            case ThreadPriority::Elevated:
+                return "elevated";
+            case ThreadPriority::Realtime:
+                return "realtime";
+        }
+
+        return "unknown";
+    }
+
+#if APL
+    void setThreadName(const char *name) {
+        pthread_setname_np(name);
+    }
+
+    bool setThreadAffinity(uint64_t mask) {
+        // macOS has no hard affinity, only scheduling hints
+        return false;
+    }
+
+    bool setThreadPriority(ThreadPriority priority) {
+        if (priority == ThreadPriority::Normal) {
+            return true;
+        }
+
+        qos_class_t qosClass = priority == ThreadPriority::Realtime ? QOS_CLASS_USER_INTERACTIVE : QOS_CLASS_USER_INITIATED;
+        return pthread_set_qos_class_self_np(qosClass, 0) == 0;
+    }
+#elif IBM
+    void setThreadName(const char *name) {
+        // SetThreadDescription only exists from Windows 10 1607 on
+        typedef HRESULT(WINAPI * SetThreadDescriptionFunc)(HANDLE, PCWSTR);
+        auto setThreadDescription = reinterpret_cast<SetThreadDescriptionFunc>(reinterpret_cast<void *>(GetProcAddress(GetModuleHandleA("kernel32.dll"), "SetThreadDescription")));
+        if (!setThreadDescription) {
+            return;
+        }
+
+        wchar_t wideName[32] = {};
+        MultiByteToWideChar(CP_UTF8, 0, name, -1, wideName, sizeof(wideName) / sizeof(wideName[0]));
+        setThreadDescription(GetCurrentThread(), wideName);
+    }
+
+    bool setThreadAffinity(uint64_t mask) {
+        return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(mask)) != 0;
+    }
+
+    bool setThreadPriority(ThreadPriority priority) {
+        if (priority == ThreadPriority::Normal) {
+            return true;
+        }
+
+        int level = priority == ThreadPriority::Realtime ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_ABOVE_NORMAL;
+        return SetThreadPriority(GetCurrentThread(), level) != 0;
+    }
+#elif LIN
+    void setThreadName(const char *name) {
+        pthread_setname_np(pthread_self(), name);
+    }
+
+    bool setThreadAffinity(uint64_t mask) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (int cpu = 0; cpu < 64; ++cpu) {
+            if (mask & (1ULL << cpu)) {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+    }
+
+    bool setThreadPriority(ThreadPriority priority) {
+        if (priority == ThreadPriority::Realtime) {
+            // Needs CAP_SYS_NICE or an RLIMIT_RTPRIO allowance
+            struct sched_param param = {};
+            param.sched_priority = 10;
+            return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+        }
+
+        if (priority == ThreadPriority::Elevated) {
+            // Nice values are per thread on Linux; going below 0 needs RLIMIT_NICE or CAP_SYS_NICE
+            return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), -5) == 0;
+        }
+
+        return true;
+    }
+#endif
+}
+
+void ThreadPolicy::Apply(ThreadRole role) {
+    RoleSettings settings = settingsForRole(role);
+    setThreadName(settings.name);
+
+    char affinity[48] = "any CPU";
+    if (affinityMask != 0) {
+        bool applied = setThreadAffinity(affinityMask);
+        snprintf(affinity, sizeof(affinity), "CPU mask 0x%llx%s", (unsigned long long) affinityMask, applied ? "" : " (not applied)");
+    }
+
+    ThreadPriority priority = settings.priority;
+    while (priority != ThreadPriority::Normal && !setThreadPriority(priority)) {
+        priority = static_cast<ThreadPriority>(static_cast<int>(priority) - 1);
+    }
+
+    std::string description = std::string(affinity) + ", " + priorityName(priority) + " priority";
+    if (priority != settings.priority) {
+        description += std::string(" (") + priorityName(settings.priority) + " not permitted)";
+    }
+
+    std::lock_guard<std::mutex> lock(appliedMutex);
+    auto previous = appliedPolicies.find(settings.name);
+    if (previous == appliedPolicies.end() || previous->second != description) {
+        debug("Thread %s: %s\n", settings.name, description.c_str());
+    }
+    appliedPolicies[settings.name] = description;
+}
+
+std::vector<std::string> ThreadPolicy::AppliedPolicies() {
+    std::lock_guard<std::mutex> lock(appliedMutex);
+
+    std::vector<std::string> result;
+    for (const auto &[name, description] : appliedPolicies) {
+        result.push_back(name + ": " + description);
+    }
+    return result;
+}
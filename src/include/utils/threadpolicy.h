@@ -0,0 +1,30 @@
+#ifndef THREADPOLICY_H
+#define THREADPOLICY_H
+
+#include <string>
+#include <vector>
+
+enum class ThreadRole : unsigned char {
+    DeviceInput,   // Reads HID reports
+    DeviceOutput,  // Drains the USB output queue
+    DeviceIO,      // Product specific I/O workers (PAP3)
+    DeviceMonitor, // Hotplug monitoring
+    DeviceBringUp, // Opens and initialises a new device
+    CaptureReplay, // Feeds a recorded HID capture back into the devices
+};
+
+enum class ThreadPriority : unsigned char {
+    Normal,
+    Elevated,
+    Realtime,
+};
+
+// Names, pins and prioritises the calling thread according to the settings in config.h.
+// Every thread the plugin creates calls Apply() first thing.
+class ThreadPolicy {
+    public:
+        static void Apply(ThreadRole role);
+        static std::vector<std::string> AppliedPolicies();
+};
+
+#endif
@@ -0,0 +1,122 @@
+#include "hidcapture.h"
+
+#include "appstate.h"
+#include "config.h"
+#include "usbdevice.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+#include <XPLMUtilities.h>
+
+HIDCapture *HIDCapture::instance = nullptr;
+
+namespace {
+    void storeLittleEndian(uint8_t *destination, uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            destination[i] = (uint8_t) (value >> (8 * i));
+        }
+    }
+
+    void appendLittleEndian(std::vector<uint8_t> &buffer, uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            buffer.push_back((uint8_t) (value >> (8 * i)));
+        }
+    }
+}
+
+HIDCapture::HIDCapture() {}
+
+HIDCapture *HIDCapture::getInstance() {
+    if (instance == nullptr) {
+        instance = new HIDCapture();
+    }
+    return instance;
+}
+
+bool HIDCapture::start(const std::string &capturePath) {
+    stop();
+
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(capturePath).parent_path(), error);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    file = fopen(capturePath.c_str(), "wb");
+    if (!file) {
+        debug_force("Could not open HID capture file %s\n", capturePath.c_str());
+        return false;
+    }
+
+    std::vector<uint8_t> header(Magic, Magic + sizeof(Magic));
+    appendLittleEndian(header, Version, 2);
+    fwrite(header.data(), 1, header.size(), file);
+
+    path = capturePath;
+    startTime = std::chrono::steady_clock::now();
+    deviceIds.clear();
+    recordCount = 0;
+    active = true;
+
+    debug_force("Capturing HID traffic to %s\n", path.c_str());
+    return true;
+}
+
+void HIDCapture::stop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!file) {
+        return;
+    }
+
+    active = false;
+    fclose(file);
+    file = nullptr;
+    debug_force("HID capture stopped, %zu records from %zu devices in %s\n", recordCount, deviceIds.size(), path.c_str());
+}
+
+const std::string &HIDCapture::lastPath() {
+    return path;
+}
+
+bool HIDCapture::isActive() {
+    return active.load(std::memory_order_relaxed);
+}
+
+void HIDCapture::record(USBDevice *device, HIDCaptureRecordType type, std::span<const uint8_t> report) {
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!file) {
+        return;
+    }
+
+    auto it = deviceIds.find(device->identity);
+    if (it == deviceIds.end()) {
+        it = deviceIds.emplace(device->identity, (uint16_t) deviceIds.size()).first;
+
+        std::vector<uint8_t> description;
+        appendLittleEndian(description, device->vendorId, 2);
+        appendLittleEndian(description, device->productId, 2);
+        description.insert(description.end(), device->identity.begin(), device->identity.end());
+        description.push_back(0);
+        description.insert(description.end(), device->productName.begin(), device->productName.end());
+        description.push_back(0);
+        writeRecord(HIDCaptureRecordType::Device, it->second, now, description);
+    }
+
+    writeRecord(type, it->second, now, report);
+    recordCount++;
+}
+
+void HIDCapture::writeRecord(HIDCaptureRecordType type, uint16_t deviceId, std::chrono::steady_clock::time_point time, std::span<const uint8_t> payload) {
+    uint64_t nanoseconds = (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(time - startTime).count();
+    size_t length = std::min<size_t>(payload.size(), UINT16_MAX);
+
+    uint8_t header[13];
+    header[0] = (uint8_t) type;
+    storeLittleEndian(header + 1, deviceId, 2);
+    storeLittleEndian(header + 3, nanoseconds, 8);
+    storeLittleEndian(header + 11, length, 2);
+
+    fwrite(header, 1, sizeof(header), file);
+    fwrite(payload.data(), 1, length, file);
+}
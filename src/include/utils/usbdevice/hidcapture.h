@@ -0,0 +1,59 @@
+#ifndef HIDCAPTURE_H
+#define HIDCAPTURE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+class USBDevice;
+
+enum class HIDCaptureRecordType : uint8_t {
+    Device = 0, // Describes a device id, written before its first report
+    Input = 1,
+    Output = 2,
+};
+
+// Records every input and output report of every device to one compact binary file, so a
+// problem can be looked at (tools/wwcap_to_pcap.py, Wireshark) or replayed (HIDReplay)
+// without the hardware or the aircraft state that caused it.
+//
+// Layout, little endian: the 8 byte magic "WWHIDCAP" and a u16 version, then records of
+// u8 type, u16 device id, u64 nanoseconds since the capture started, u16 length and the
+// payload. A Device record's payload is u16 vendor id, u16 product id, then the device
+// identity and product name, each NUL terminated.
+class HIDCapture {
+    private:
+        HIDCapture();
+        static HIDCapture *instance;
+
+        std::atomic<bool> active = false;
+        std::mutex mutex;
+        FILE *file = nullptr;
+        std::string path;
+        std::chrono::steady_clock::time_point startTime;
+        std::unordered_map<std::string, uint16_t> deviceIds;
+        size_t recordCount = 0;
+
+        void writeRecord(HIDCaptureRecordType type, uint16_t deviceId, std::chrono::steady_clock::time_point time, std::span<const uint8_t> payload);
+
+    public:
+        static constexpr char Magic[8] = {'W', 'W', 'H', 'I', 'D', 'C', 'A', 'P'};
+        static constexpr uint16_t Version = 1;
+
+        static HIDCapture *getInstance();
+
+        bool start(const std::string &path);
+        void stop();
+        const std::string &lastPath();
+
+        // Called from the I/O threads; costs one relaxed load while no capture is running
+        bool isActive();
+        void record(USBDevice *device, HIDCaptureRecordType type, std::span<const uint8_t> report);
+};
+
+#endif
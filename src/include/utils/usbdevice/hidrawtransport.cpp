@@ -0,0 +1,144 @@
+#if LIN
+#include "hidrawtransport.h"
+
+#include "appstate.h"
+#include "config.h"
+
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/hidraw.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <XPLMUtilities.h>
+
+// Added in Linux 5.11; defined here so older build headers still get it, the kernel decides at runtime.
+#ifndef HIDIOCGINPUT
+#define HIDIOCGINPUT(len) _IOC(_IOC_WRITE | _IOC_READ, 'H', 0x0A, len)
+#endif
+
+thread_local int HidrawTransport::lastErrno = 0;
+
+HidrawTransport::HidrawTransport(const std::string &aDevicePath, int aFd) :
+    fd(aFd), devicePath(aDevicePath) {
+    wakeFd = eventfd(0, EFD_CLOEXEC);
+    if (wakeFd < 0) {
+        debug_force("Failed to create input wake eventfd: %s\n", strerror(errno));
+    }
+}
+
+HidrawTransport::~HidrawTransport() {
+    close();
+
+    if (wakeFd >= 0) {
+        ::close(wakeFd);
+        wakeFd = -1;
+    }
+}
+
+std::string HidrawTransport::name() {
+    return devicePath;
+}
+
+const char *HidrawTransport::lastError() {
+    return strerror(lastErrno);
+}
+
+bool HidrawTransport::open() {
+    if (fd >= 0) {
+        return true;
+    }
+
+    if (devicePath.empty()) {
+        return false;
+    }
+
+    fd = ::open(devicePath.c_str(), O_RDWR | O_CLOEXEC);
+    lastErrno = fd < 0 ? errno : 0;
+    return fd >= 0;
+}
+
+void HidrawTransport::close() {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+bool HidrawTransport::isOpen() {
+    return fd >= 0;
+}
+
+int HidrawTransport::read(std::span<uint8_t> buffer) {
+    struct pollfd fds[2] = {{fd, POLLIN, 0}, {wakeFd, POLLIN, 0}};
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            lastErrno = errno;
+            return -1;
+        }
+
+        if (fds[1].revents) {
+            uint64_t wakes;
+            if (::read(wakeFd, &wakes, sizeof(wakes)) < 0) {
+                debug_force("Failed to reset input wake eventfd: %s\n", strerror(errno));
+            }
+            return 0;
+        }
+
+        if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            // Device unplugged or reset
+            lastErrno = ENODEV;
+            return -1;
+        }
+
+        ssize_t bytesRead = ::read(fd, buffer.data(), buffer.size());
+        if (bytesRead > 0) {
+            return (int) bytesRead;
+        }
+
+        if (bytesRead == 0) {
+            // EOF - device disconnected
+            lastErrno = ENODEV;
+            return -1;
+        }
+
+        if (errno != EAGAIN && errno != EINTR) {
+            lastErrno = errno;
+            return -1;
+        }
+    }
+}
+
+void HidrawTransport::interruptRead() {
+    uint64_t wake = 1;
+    if (wakeFd >= 0 && ::write(wakeFd, &wake, sizeof(wake)) < 0) {
+        debug_force("Failed to wake input thread: %s\n", strerror(errno));
+    }
+}
+
+bool HidrawTransport::write(std::span<const uint8_t> report) {
+    ssize_t bytesWritten = ::write(fd, report.data(), report.size());
+    if (bytesWritten == (ssize_t) report.size()) {
+        return true;
+    }
+
+    lastErrno = bytesWritten < 0 ? errno : EIO;
+    return false;
+}
+
+int HidrawTransport::getInputReport(uint8_t reportId, std::span<uint8_t> buffer) {
+    if (buffer.empty()) {
+        return -1;
+    }
+
+    buffer[0] = reportId;
+    int bytesRead = ioctl(fd, HIDIOCGINPUT(buffer.size()), buffer.data());
+    lastErrno = bytesRead < 0 ? errno : 0;
+    return bytesRead;
+}
+#endif
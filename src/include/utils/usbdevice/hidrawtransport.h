@@ -0,0 +1,39 @@
+#ifndef HIDRAWTRANSPORT_H
+#define HIDRAWTRANSPORT_H
+
+#include "hidtransport.h"
+
+#include <string>
+
+// A Linux /dev/hidraw node. Reads poll the node together with an eventfd, which is what
+// interruptRead() signals.
+class HidrawTransport : public HIDTransport {
+    private:
+        int fd = -1;
+        int wakeFd = -1;
+
+        // Per thread, as input, output and bring-up each call into the same transport
+        static thread_local int lastErrno;
+
+    protected:
+        std::string devicePath;
+
+    public:
+        // Takes over fd if it is already open, otherwise open() opens devicePath
+        HidrawTransport(const std::string &devicePath, int fd = -1);
+        ~HidrawTransport() override;
+
+        std::string name() override;
+        const char *lastError() override;
+
+        bool open() override;
+        void close() override;
+        bool isOpen() override;
+
+        int read(std::span<uint8_t> buffer) override;
+        void interruptRead() override;
+        bool write(std::span<const uint8_t> report) override;
+        int getInputReport(uint8_t reportId, std::span<uint8_t> buffer) override;
+};
+
+#endif
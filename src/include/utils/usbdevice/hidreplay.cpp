@@ -0,0 +1,204 @@
+#include "hidreplay.h"
+
+#include "appstate.h"
+#include "config.h"
+#include "hidcapture.h"
+#include "threadpolicy.h"
+#include "usbcontroller.h"
+#include "usbdevice.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <XPLMUtilities.h>
+
+HIDReplay *HIDReplay::instance = nullptr;
+
+namespace {
+    uint64_t loadLittleEndian(const uint8_t *source, size_t bytes) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; ++i) {
+            value |= (uint64_t) source[i] << (8 * i);
+        }
+        return value;
+    }
+}
+
+HIDReplay::HIDReplay() {}
+
+HIDReplay *HIDReplay::getInstance() {
+    if (instance == nullptr) {
+        instance = new HIDReplay();
+    }
+    return instance;
+}
+
+bool HIDReplay::start(const std::string &path, bool originalTiming) {
+    stop();
+
+    std::vector<ReplayedReport> reports;
+    if (!load(path, reports)) {
+        return false;
+    }
+
+    if (reports.empty()) {
+        debug_force("Nothing to replay from %s: no input reports for connected devices\n", path.c_str());
+        return false;
+    }
+
+    debug_force("Replaying %zu input reports from %s %s\n", reports.size(), path.c_str(), originalTiming ? "at original timing" : "as fast as possible");
+    stopping = false;
+    forgottenDevices.clear();
+    running = true;
+    replayThread = std::thread([this, reports = std::move(reports), originalTiming]() mutable {
+        ThreadPolicy::Apply(ThreadRole::CaptureReplay);
+        replay(std::move(reports), originalTiming);
+        running = false;
+    });
+    return true;
+}
+
+void HIDReplay::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    stopRequested.notify_all();
+
+    if (replayThread.joinable()) {
+        replayThread.join();
+    }
+}
+
+// Reports are handed over with the mutex held, so once this returns the device isn't touched again
+void HIDReplay::forget(const USBDevice *device) {
+    std::lock_guard<std::mutex> lock(mutex);
+    forgottenDevices.insert(device);
+}
+
+bool HIDReplay::isRunning() {
+    return running;
+}
+
+bool HIDReplay::load(const std::string &path, std::vector<ReplayedReport> &reports) {
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!file.good() && !file.eof()) {
+        debug_force("Could not read HID capture %s\n", path.c_str());
+        return false;
+    }
+
+    const size_t headerSize = sizeof(HIDCapture::Magic) + 2;
+    if (contents.size() < headerSize || memcmp(contents.data(), HIDCapture::Magic, sizeof(HIDCapture::Magic)) != 0 || loadLittleEndian(contents.data() + sizeof(HIDCapture::Magic), 2) != HIDCapture::Version) {
+        debug_force("%s is not an HID capture this version can read\n", path.c_str());
+        return false;
+    }
+
+    struct CapturedDevice {
+            uint16_t deviceId;
+            uint16_t vendorId;
+            uint16_t productId;
+            std::string identity;
+    };
+    struct CapturedInput {
+            uint16_t deviceId;
+            std::chrono::nanoseconds time;
+            const uint8_t *payload;
+            size_t length;
+    };
+    std::vector<CapturedDevice> capturedDevices;
+    std::vector<CapturedInput> capturedInputs;
+
+    size_t offset = headerSize;
+    while (offset + 13 <= contents.size()) {
+        const uint8_t *record = contents.data() + offset;
+        auto type = static_cast<HIDCaptureRecordType>(record[0]);
+        uint16_t deviceId = (uint16_t) loadLittleEndian(record + 1, 2);
+        std::chrono::nanoseconds time((int64_t) loadLittleEndian(record + 3, 8));
+        size_t length = loadLittleEndian(record + 11, 2);
+        if (offset + 13 + length > contents.size()) {
+            debug_force("HID capture %s is truncated, replaying what is complete\n", path.c_str());
+            break;
+        }
+
+        const uint8_t *payload = record + 13;
+        offset += 13 + length;
+
+        if (type == HIDCaptureRecordType::Device && length >= 4) {
+            uint16_t vendorId = (uint16_t) loadLittleEndian(payload, 2);
+            uint16_t productId = (uint16_t) loadLittleEndian(payload + 2, 2);
+            std::string identity(reinterpret_cast<const char *>(payload + 4), strnlen(reinterpret_cast<const char *>(payload + 4), length - 4));
+            capturedDevices.push_back({deviceId, vendorId, productId, identity});
+        } else if (type == HIDCaptureRecordType::Input && length > 0) {
+            capturedInputs.push_back({deviceId, time, payload, length});
+        }
+    }
+
+    // Exact matches first, so a unit that is attached again isn't taken by a fallback of its model
+    std::vector<USBDevice *> targets;
+    std::vector<USBDevice *> taken;
+    for (auto &captured : capturedDevices) {
+        if (targets.size() <= captured.deviceId) {
+            targets.resize(captured.deviceId + 1, nullptr);
+        }
+
+        if (USBDevice *device = USBController::getInstance()->deviceWithIdentity(captured.identity)) {
+            targets[captured.deviceId] = device;
+            taken.push_back(device);
+        }
+    }
+
+    for (auto &captured : capturedDevices) {
+        USBDevice *&device = targets[captured.deviceId];
+        if (!device) {
+            for (auto *candidate : USBController::getInstance()->devices) {
+                if (candidate->vendorId == captured.vendorId && candidate->productId == captured.productId && std::find(taken.begin(), taken.end(), candidate) == taken.end()) {
+                    device = candidate;
+                    taken.push_back(device);
+                    break;
+                }
+            }
+        }
+
+        debug("Capture device %u (%04x:%04x) replays into %s\n", captured.deviceId, captured.vendorId, captured.productId, device ? device->productName.c_str() : "nothing, not connected");
+    }
+
+    for (auto &input : capturedInputs) {
+        if (input.deviceId < targets.size() && targets[input.deviceId]) {
+            reports.push_back({targets[input.deviceId], input.time, std::vector<uint8_t>(input.payload, input.payload + input.length)});
+        }
+    }
+
+    // Records from different I/O threads can land in the file slightly out of order
+    std::stable_sort(reports.begin(), reports.end(), [](const ReplayedReport &a, const ReplayedReport &b) {
+        return a.time < b.time;
+    });
+    return true;
+}
+
+void HIDReplay::replay(std::vector<ReplayedReport> reports, bool originalTiming) {
+    auto start = std::chrono::steady_clock::now();
+    auto firstReportTime = reports.front().time;
+
+    size_t replayed = 0;
+    for (auto &report : reports) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (originalTiming) {
+            stopRequested.wait_until(lock, start + (report.time - firstReportTime), [this] {
+                return stopping;
+            });
+        }
+        if (stopping) {
+            break;
+        }
+        if (forgottenDevices.contains(report.device)) {
+            continue;
+        }
+
+        report.device->replayInputReport(report.data);
+        replayed++;
+    }
+
+    debug_force("HID replay finished, %zu of %zu input reports replayed\n", replayed, reports.size());
+}
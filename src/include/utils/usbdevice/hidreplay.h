@@ -0,0 +1,51 @@
+#ifndef HIDREPLAY_H
+#define HIDREPLAY_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+class USBDevice;
+
+// Feeds the input reports of an HIDCapture file back into the live devices, through the same
+// InputReportCallback path real reports take. Capture devices are matched by identity, the rest
+// by vendor/product ID to one device each; reports of devices that aren't connected are skipped.
+class HIDReplay {
+    private:
+        struct ReplayedReport {
+                USBDevice *device;
+                std::chrono::nanoseconds time;
+                std::vector<uint8_t> data;
+        };
+
+        HIDReplay();
+        static HIDReplay *instance;
+
+        std::thread replayThread;
+        std::mutex mutex;
+        std::condition_variable stopRequested;
+        bool stopping = false;
+        std::unordered_set<const USBDevice *> forgottenDevices; // Removed since the replay started
+        std::atomic<bool> running = false;
+
+        bool load(const std::string &path, std::vector<ReplayedReport> &reports);
+        void replay(std::vector<ReplayedReport> reports, bool originalTiming);
+
+    public:
+        static HIDReplay *getInstance();
+
+        // Main thread only. Without originalTiming, reports are fed back as fast as they are taken.
+        bool start(const std::string &path, bool originalTiming);
+        void stop();
+        // Main thread, before a device goes away. Its reports are skipped, the rest keep playing.
+        void forget(const USBDevice *device);
+        bool isRunning();
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef HIDTRANSPORT_H
+#define HIDTRANSPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+// The byte level link between a USBDevice and the unit it drives. On Linux every USBDevice
+// goes through one of these, so products can run against something other than real hardware:
+// HidrawTransport for /dev/hidraw nodes and LoopbackTransport in memory.
+class HIDTransport {
+    public:
+        virtual ~HIDTransport() = default;
+
+        // Where the transport leads, used in logs
+        virtual std::string name() = 0;
+        // Why the last call made on this thread failed
+        virtual const char *lastError() = 0;
+
+        // open() may be called again after close() to reach the same device
+        virtual bool open() = 0;
+        virtual void close() = 0;
+        virtual bool isOpen() = 0;
+
+        // Blocks until a report arrives. Returns its length, 0 when interrupted by interruptRead()
+        // and -1 once the device is gone. Only one thread reads at a time.
+        virtual int read(std::span<uint8_t> buffer) = 0;
+
+        // Wakes the reader, or the next read() if nobody is reading yet
+        virtual void interruptRead() = 0;
+
+        virtual bool write(std::span<const uint8_t> report) = 0;
+
+        // Fetches the current input report with the given ID without waiting for the device to send it.
+        // Returns the report length or -1.
+        virtual int getInputReport(uint8_t reportId, std::span<uint8_t> buffer) = 0;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "loopbacktransport.h"
+
+#include <algorithm>
+#include <utility>
+
+LoopbackTransport::LoopbackTransport(const std::string &name) :
+    transportName(name) {}
+
+std::string LoopbackTransport::name() {
+    return transportName;
+}
+
+const char *LoopbackTransport::lastError() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!attached) {
+        return "loopback device detached";
+    }
+    return opened ? "no error" : "loopback device not open";
+}
+
+bool LoopbackTransport::open() {
+    std::lock_guard<std::mutex> lock(mutex);
+    opened = attached;
+    return opened;
+}
+
+void LoopbackTransport::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        opened = false;
+        pendingReports.clear();
+    }
+    reportAvailable.notify_all();
+}
+
+bool LoopbackTransport::isOpen() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return opened;
+}
+
+int LoopbackTransport::read(std::span<uint8_t> buffer) {
+    std::unique_lock<std::mutex> lock(mutex);
+    reportAvailable.wait(lock, [this] {
+        return interrupted || !opened || !attached || !pendingReports.empty();
+    });
+
+    if (interrupted) {
+        interrupted = false;
+        return 0;
+    }
+
+    if (!opened || !attached) {
+        return -1;
+    }
+
+    std::vector<uint8_t> report = std::move(pendingReports.front());
+    pendingReports.pop_front();
+
+    size_t length = std::min(report.size(), buffer.size());
+    std::copy_n(report.begin(), length, buffer.begin());
+    return (int) length;
+}
+
+void LoopbackTransport::interruptRead() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        interrupted = true;
+    }
+    reportAvailable.notify_all();
+}
+
+bool LoopbackTransport::write(std::span<const uint8_t> report) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!opened || !attached) {
+        return false;
+    }
+
+    writes.push_back({std::chrono::steady_clock::now(), std::vector<uint8_t>(report.begin(), report.end())});
+    totalWrites++;
+    return true;
+}
+
+int LoopbackTransport::getInputReport(uint8_t reportId, std::span<uint8_t> buffer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = currentReports.find(reportId);
+    if (!opened || !attached || it == currentReports.end()) {
+        return -1;
+    }
+
+    size_t length = std::min(it->second.size(), buffer.size());
+    std::copy_n(it->second.begin(), length, buffer.begin());
+    return (int) length;
+}
+
+void LoopbackTransport::injectReport(std::span<const uint8_t> report) {
+    if (report.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentReports[report[0]].assign(report.begin(), report.end());
+        if (opened && attached) {
+            pendingReports.emplace_back(report.begin(), report.end());
+        }
+    }
+    reportAvailable.notify_all();
+}
+
+std::vector<LoopbackTransport::RecordedWrite> LoopbackTransport::takeWrites() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::exchange(writes, {});
+}
+
+size_t LoopbackTransport::writeCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalWrites;
+}
+
+void LoopbackTransport::setAttached(bool isAttached) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        attached = isAttached;
+        if (!attached) {
+            opened = false;
+            pendingReports.clear();
+        }
+    }
+    reportAvailable.notify_all();
+}
@@ -0,0 +1,59 @@
+#ifndef LOOPBACKTRANSPORT_H
+#define LOOPBACKTRANSPORT_H
+
+#include "hidtransport.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// An in-memory device: everything the product writes is recorded with a timestamp, and
+// reports injected from the other side come out of read() as if the unit had sent them.
+// Lets products run headless, for benchmarks or to reproduce a report sequence.
+class LoopbackTransport : public HIDTransport {
+    public:
+        struct RecordedWrite {
+                std::chrono::steady_clock::time_point time;
+                std::vector<uint8_t> data;
+        };
+
+    private:
+        std::string transportName;
+        std::mutex mutex;
+        std::condition_variable reportAvailable;
+        std::deque<std::vector<uint8_t>> pendingReports;
+        std::unordered_map<uint8_t, std::vector<uint8_t>> currentReports;
+        std::vector<RecordedWrite> writes;
+        size_t totalWrites = 0;
+        bool opened = false;
+        bool attached = true;
+        bool interrupted = false;
+
+    public:
+        LoopbackTransport(const std::string &name = "loopback");
+
+        std::string name() override;
+        const char *lastError() override;
+
+        bool open() override;
+        void close() override;
+        bool isOpen() override;
+
+        int read(std::span<uint8_t> buffer) override;
+        void interruptRead() override;
+        bool write(std::span<const uint8_t> report) override;
+        int getInputReport(uint8_t reportId, std::span<uint8_t> buffer) override;
+
+        // Device side
+        void injectReport(std::span<const uint8_t> report);
+        std::vector<RecordedWrite> takeWrites();
+        size_t writeCount();
+
+        // Detaching behaves like an unplug: read() returns -1, writes and open() fail until reattached
+        void setAttached(bool attached);
+};
+
+#endif
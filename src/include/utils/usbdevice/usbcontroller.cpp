@@ -1,6 +1,13 @@
 #include "usbcontroller.h"
 
 #include "appstate.h"
+#include "config.h"
+#include "hidreplay.h"
+#include "threadpolicy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <XPLMUtilities.h>
 
 bool USBController::allProfilesReady() {
     for (auto &device : devices) {
@@ -18,9 +25,214 @@ void USBController::connectAllDevices() {
     });
 }
 
+// Devices are constructed (opened and initialised) on worker threads and handed over here, on the
+// main thread, as soon as each one is ready. Profiles are only bound afterwards, from update().
+// Devices that stopped responding are reopened from here as well.
+void USBController::update() {
+    for (auto it = pendingDevices.begin(); it != pendingDevices.end();) {
+        if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        USBDevice *device = it->second.get();
+        if (device) {
+            debug("%s is ready at %s\n", device->classIdentifier(), it->first.c_str());
+            registerDevice(device, it->first);
+        }
+        it = pendingDevices.erase(it);
+    }
+
+    // Their paths were held back meanwhile, so whatever is attached there now is picked up again
+    if (deleteAbandonedDevices(false)) {
+        enumerateDevices();
+    }
+
+    std::vector<USBDevice *> lost;
+    for (auto &device : devices) {
+        device->stats.refresh();
+        if (device->reconnectDue() && !isRemovalPending(device->devicePath)) {
+            lost.push_back(device);
+        }
+    }
+
+    for (auto *device : lost) {
+        reconnectDevice(device);
+    }
+}
+
+void USBController::bringUpDevice(const std::string &devicePath, std::function<USBDevice *()> create) {
+    pendingDevices[devicePath] = std::async(std::launch::async, [create = std::move(create)]() {
+        ThreadPolicy::Apply(ThreadRole::DeviceBringUp);
+        return create();
+    });
+}
+
+// A half constructed device can't be deleted safely, so one that is no longer wanted is left to
+// finish on its worker and deleted from update() after that, without holding up the main thread.
+void USBController::abandonPendingDevice(const std::string &devicePath) {
+    auto pending = pendingDevices.find(devicePath);
+    if (pending == pendingDevices.end()) {
+        return;
+    }
+
+    abandonedDevices.emplace_back(devicePath, std::move(pending->second));
+    pendingDevices.erase(pending);
+}
+
+// Returns whether any device was deleted
+bool USBController::deleteAbandonedDevices(bool wait) {
+    bool deleted = false;
+    for (auto it = abandonedDevices.begin(); it != abandonedDevices.end();) {
+        if (!wait && it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        // One that was reconnecting may still be in a replay
+        USBDevice *device = it->second.get();
+        HIDReplay::getInstance()->forget(device);
+
+        delete device;
+        it = abandonedDevices.erase(it);
+        deleted = true;
+    }
+
+    return deleted;
+}
+
+// A path stays taken until an abandoned device on it is deleted, so its teardown can't reach a unit
+// that was brought up again on the same path in the meantime.
+bool USBController::isKnownPath(const std::string &devicePath) {
+    return devicesByPath.contains(devicePath) || pendingDevices.contains(devicePath) || std::any_of(abandonedDevices.begin(), abandonedDevices.end(), [&](const auto &abandoned) {
+               return abandoned.first == devicePath;
+           });
+}
+
 void USBController::disconnectAllDevices() {
+    while (!pendingDevices.empty()) {
+        abandonPendingDevice(pendingDevices.begin()->first);
+    }
+
+    HIDReplay::getInstance()->stop();
     for (auto ptr : devices) {
         delete ptr;
     }
     devices.clear();
+    devicesByPath.clear();
+    devicesByIdentity.clear();
+}
+
+void USBController::unloadAllProfiles() {
+    for (auto device : devices) {
+        device->unloadProfile();
+    }
+}
+
+USBDevice *USBController::deviceAtPath(const std::string &devicePath) {
+    auto it = devicesByPath.find(devicePath);
+    return it != devicesByPath.end() ? it->second : nullptr;
+}
+
+USBDevice *USBController::deviceWithIdentity(const std::string &identity) {
+    auto it = devicesByIdentity.find(identity);
+    return it != devicesByIdentity.end() ? it->second : nullptr;
+}
+
+void USBController::withRetainedState(const std::string &identity, const std::function<void(USBDeviceRetainedState &)> &access) {
+    std::lock_guard<std::mutex> lock(retainedStatesMutex);
+    access(retainedStates[identity]);
+}
+
+void USBController::registerDevice(USBDevice *device, const std::string &devicePath) {
+    // Two units of the same model get winwing/stats/<name>, winwing/stats/<name>_2, ...
+    std::string baseName = USBDeviceStats::DatarefName(device->productName);
+    auto nameTaken = [this](const std::string &name) {
+        return std::any_of(devices.begin(), devices.end(), [&](USBDevice *other) {
+            return other->stats.name() == name;
+        });
+    };
+
+    std::string statsName = baseName;
+    for (int suffix = 2; nameTaken(statsName); ++suffix) {
+        statsName = baseName + "_" + std::to_string(suffix);
+    }
+    device->stats.publish(statsName);
+    device->publishSettings(statsName);
+
+    device->devicePath = devicePath;
+    devices.push_back(device);
+    devicesByPath[devicePath] = device;
+    devicesByIdentity[device->identity] = device;
+}
+
+void USBController::unregisterDevice(USBDevice *device) {
+    devices.erase(std::remove(devices.begin(), devices.end(), device), devices.end());
+    devicesByPath.erase(device->devicePath);
+
+    auto identityIt = devicesByIdentity.find(device->identity);
+    if (identityIt != devicesByIdentity.end() && identityIt->second == device) {
+        devicesByIdentity.erase(identityIt);
+    }
+}
+
+void USBController::removeDevice(USBDevice *device, bool unplugged) {
+    // The replay thread may be about to hand this device a report
+    HIDReplay::getInstance()->forget(device);
+
+    unregisterDevice(device);
+
+    // Anything uploaded to the unit is gone once it loses power, the rest of its state is kept.
+    if (unplugged) {
+        withRetainedState(device->identity, [](USBDeviceRetainedState &state) {
+            state.residentContent.clear();
+        });
+    }
+
+    delete device;
+}
+
+// Reopening blocks on the device, so the product's own disconnect() and connect() run on a worker
+// like a bring-up and the device is registered again once they are done. The profile goes through
+// the XPLM API and is unloaded here first, it is bound again from update() as after a bring-up.
+void USBController::reconnectDevice(USBDevice *device) {
+    std::string devicePath = device->devicePath;
+    device->unloadProfile();
+    unregisterDevice(device);
+
+    bringUpDevice(devicePath, [device]() {
+        device->reconnect();
+        return device;
+    });
+}
+
+// Called from the thread that noticed the unplug, the registry is only touched from the main thread
+void USBController::scheduleRemoval(const std::string &devicePath) {
+    {
+        std::lock_guard<std::mutex> lock(pendingRemovalsMutex);
+        pendingRemovals.insert(devicePath);
+    }
+
+    AppState::getInstance()->executeAfter(0, [this, devicePath]() {
+        removeDeviceAtPath(devicePath);
+    });
+}
+
+void USBController::removeDeviceAtPath(const std::string &devicePath) {
+    {
+        std::lock_guard<std::mutex> lock(pendingRemovalsMutex);
+        pendingRemovals.erase(devicePath);
+    }
+
+    abandonPendingDevice(devicePath);
+
+    if (USBDevice *removed = deviceAtPath(devicePath)) {
+        removeDevice(removed, true);
+    }
+}
+
+// A unit that is being removed is not worth reopening
+bool USBController::isRemovalPending(const std::string &devicePath) {
+    std::lock_guard<std::mutex> lock(pendingRemovalsMutex);
+    return pendingRemovals.contains(devicePath);
 }
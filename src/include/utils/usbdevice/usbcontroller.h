@@ -3,8 +3,14 @@
 
 #include "usbdevice.h"
 
+#include <condition_variable>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #if APL
@@ -23,38 +29,61 @@ typedef HANDLE HIDDeviceHandle;
 #elif LIN
 #include <libudev.h>
 typedef struct udev_monitor *HIDManagerHandle;
-typedef int HIDDeviceHandle;
+typedef HIDTransport *HIDDeviceHandle;
 #endif
 
 class USBController {
     private:
         HIDManagerHandle hidManager;
         bool shouldShutdown = false;
+        std::thread monitorThread;
 
         USBController();
         ~USBController();
         static USBController *instance;
 
+        std::unordered_map<std::string, USBDevice *> devicesByPath;
+        std::unordered_map<std::string, USBDevice *> devicesByIdentity;
+        std::unordered_map<std::string, USBDeviceRetainedState> retainedStates;
+        std::mutex retainedStatesMutex; // Devices use their state while being brought up on worker threads
+        std::unordered_map<std::string, std::future<USBDevice *>> pendingDevices;
+        std::vector<std::pair<std::string, std::future<USBDevice *>>> abandonedDevices; // Unplugged or reloaded during bring-up, by path
+        std::mutex pendingRemovalsMutex;
+        std::unordered_set<std::string> pendingRemovals; // Unplugged, waiting for the main thread to remove them
+
         void enumerateDevices();
+        void bringUpDevice(const std::string &devicePath, std::function<USBDevice *()> create);
+        void abandonPendingDevice(const std::string &devicePath);
+        bool deleteAbandonedDevices(bool wait);
+        bool isKnownPath(const std::string &devicePath);
+        void registerDevice(USBDevice *device, const std::string &devicePath);
+        void unregisterDevice(USBDevice *device);
+        void removeDevice(USBDevice *device, bool unplugged);
+        void reconnectDevice(USBDevice *device);
+        void scheduleRemoval(const std::string &devicePath);
+        void removeDeviceAtPath(const std::string &devicePath);
+        bool isRemovalPending(const std::string &devicePath);
 
 #if APL
         static void DeviceAddedCallback(void *context, IOReturn result, void *sender, IOHIDDeviceRef device);
         static void DeviceRemovedCallback(void *context, IOReturn result, void *sender, IOHIDDeviceRef device);
-        bool deviceExistsWithHIDDevice(IOHIDDeviceRef device);
+        static std::string DevicePath(IOHIDDeviceRef device);
 #elif IBM
+        std::mutex monitorMutex;
+        std::condition_variable monitorWake;
+
         void checkForDeviceChanges();
         void enumerateHidDevices(std::function<void(HANDLE, const std::string &)> deviceHandler);
         USBDevice *createDeviceFromHandle(HANDLE hidDevice, const std::string &devicePath);
-        bool deviceExistsWithHandle(HANDLE hidDevice);
-        bool deviceExistsWithPath(const std::string &devicePath);
         void addDeviceFromHandle(HANDLE hidDevice, const std::string &devicePath);
 #elif LIN
+        int monitorWakeFd = -1;
+
         static void DeviceAddedCallback(void *context, struct udev_device *device);
         static void DeviceRemovedCallback(void *context, struct udev_device *device);
         void monitorDevices();
-        USBDevice *createDeviceFromPath(const std::string &devicePath);
-        bool deviceExistsAtPath(const std::string &devicePath);
-        void addDeviceFromPath(const std::string &devicePath);
+        USBDevice *createDeviceFromPath(const std::string &devicePath, const std::string &identity);
+        void addDeviceFromPath(const std::string &devicePath, const std::string &identity);
 #endif
 
     public:
@@ -62,9 +91,15 @@ class USBController {
         static USBController *getInstance();
         void destroy();
 
+        void update();
         bool allProfilesReady();
         void connectAllDevices();
         void disconnectAllDevices();
+        void unloadAllProfiles();
+
+        USBDevice *deviceAtPath(const std::string &devicePath);
+        USBDevice *deviceWithIdentity(const std::string &identity);
+        void withRetainedState(const std::string &identity, const std::function<void(USBDeviceRetainedState &)> &access);
 };
 
 #endif
@@ -1,29 +1,59 @@
 #if LIN
 #include "appstate.h"
 #include "config.h"
+#include "hidrawtransport.h"
+#include "threadpolicy.h"
 #include "usbcontroller.h"
 #include "usbdevice.h"
 
-#include <atomic>
 #include <chrono>
+#include <cstdlib>
 #include <cstring>
-#include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <iostream>
 #include <libudev.h>
 #include <linux/hidraw.h>
+#include <poll.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
-#include <sys/select.h>
 #include <sys/stat.h>
 #include <thread>
 #include <unistd.h>
 #include <XPLMUtilities.h>
 
 USBController *USBController::instance = nullptr;
-static std::atomic<bool> shouldStopMonitoring{false};
+
+// Checks the USB parent of a hidraw node so we never have to open other vendors' devices.
+static bool isWinwingDevice(struct udev_device *device) {
+    struct udev_device *usbDevice = udev_device_get_parent_with_subsystem_devtype(device, "usb", "usb_device");
+    if (!usbDevice) {
+        return false;
+    }
+
+    const char *vendorId = udev_device_get_property_value(usbDevice, "ID_VENDOR_ID");
+    if (!vendorId) {
+        vendorId = udev_device_get_sysattr_value(usbDevice, "idVendor");
+    }
+
+    return vendorId && strtol(vendorId, nullptr, 16) == WINWING_VENDOR_ID;
+}
+
+// The USB interface name (e.g. "1-4.2:1.0") pins down the port and interface, the serial the unit itself.
+static std::string identityForDevice(struct udev_device *device) {
+    struct udev_device *usbInterface = udev_device_get_parent_with_subsystem_devtype(device, "usb", "usb_interface");
+    struct udev_device *usbDevice = udev_device_get_parent_with_subsystem_devtype(device, "usb", "usb_device");
+    const char *busPath = usbInterface ? udev_device_get_sysname(usbInterface) : nullptr;
+    const char *serial = usbDevice ? udev_device_get_sysattr_value(usbDevice, "serial") : nullptr;
+    const char *vendorId = usbDevice ? udev_device_get_sysattr_value(usbDevice, "idVendor") : nullptr;
+    const char *productId = usbDevice ? udev_device_get_sysattr_value(usbDevice, "idProduct") : nullptr;
+
+    return USBDevice::IdentityKey(vendorId ? strtol(vendorId, nullptr, 16) : 0, productId ? strtol(productId, nullptr, 16) : 0, busPath ? busPath : udev_device_get_devnode(device), serial ? serial : "");
+}
 
 USBController::USBController() {
+    hidManager = nullptr;
+
     struct udev *udev = udev_new();
     if (!udev) {
         debug_force("Failed to create udev context");
@@ -40,11 +70,16 @@ USBController::USBController() {
     udev_monitor_filter_add_match_subsystem_devtype(hidManager, "hidraw", nullptr);
     udev_monitor_enable_receiving(hidManager);
 
-    shouldStopMonitoring = false;
-    std::thread monitorThread([this]() {
+    monitorWakeFd = eventfd(0, EFD_CLOEXEC);
+    if (monitorWakeFd < 0) {
+        debug_force("Failed to create monitor wake eventfd: %s\n", strerror(errno));
+        return;
+    }
+
+    monitorThread = std::thread([this]() {
+        ThreadPolicy::Apply(ThreadRole::DeviceMonitor);
         monitorDevices();
     });
-    monitorThread.detach();
 }
 
 USBController::~USBController() {
@@ -59,15 +94,26 @@ USBController *USBController::getInstance() {
 }
 
 void USBController::destroy() {
-    shouldStopMonitoring = true;
+    if (monitorWakeFd >= 0) {
+        uint64_t wake = 1;
+        if (write(monitorWakeFd, &wake, sizeof(wake)) < 0) {
+            debug_force("Failed to wake monitoring thread: %s\n", strerror(errno));
+        }
+    }
 
-    // Give the monitoring thread time to exit gracefully
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (monitorThread.joinable()) {
+        monitorThread.join();
+    }
 
-    for (auto ptr : devices) {
-        delete ptr;
+    if (monitorWakeFd >= 0) {
+        close(monitorWakeFd);
+        monitorWakeFd = -1;
     }
-    devices.clear();
+
+    disconnectAllDevices();
+
+    // The plugin is going away, so bring-ups still running have to be waited for here
+    deleteAbandonedDevices(true);
 
     if (hidManager) {
         struct udev *udev = udev_monitor_get_udev(hidManager);
@@ -79,7 +125,7 @@ void USBController::destroy() {
     instance = nullptr;
 }
 
-USBDevice *USBController::createDeviceFromPath(const std::string &devicePath) {
+USBDevice *USBController::createDeviceFromPath(const std::string &devicePath, const std::string &identity) {
     int fd = open(devicePath.c_str(), O_RDWR);
     if (fd < 0) {
         return nullptr;
@@ -97,81 +143,98 @@ USBDevice *USBController::createDeviceFromPath(const std::string &devicePath) {
         return nullptr;
     }
 
-    return USBDevice::Device(fd, info.vendor, info.product, "Winwing", std::string(name));
-}
-
-bool USBController::deviceExistsAtPath(const std::string &devicePath) {
-    for (auto *dev : devices) {
-        if (dev->hidDevice >= 0) {
-            char existingPath[256];
-            snprintf(existingPath, sizeof(existingPath), "/proc/self/fd/%d", dev->hidDevice);
-            char linkTarget[256];
-            ssize_t len = readlink(existingPath, linkTarget, sizeof(linkTarget) - 1);
-            if (len > 0) {
-                linkTarget[len] = '\0';
-                if (strcmp(linkTarget, devicePath.c_str()) == 0) {
-                    return true;
-                }
-            }
-        }
+    auto *transport = new HidrawTransport(devicePath, fd);
+    USBDevice *device = USBDevice::Device(transport, info.vendor, info.product, "Winwing", std::string(name), identity);
+    if (!device) {
+        delete transport;
     }
-    return false;
+    return device;
 }
 
-void USBController::addDeviceFromPath(const std::string &devicePath) {
-    AppState::getInstance()->executeAfter(0, [this, devicePath]() {
-        if (deviceExistsAtPath(devicePath)) {
+void USBController::addDeviceFromPath(const std::string &devicePath, const std::string &identity) {
+    AppState::getInstance()->executeAfter(0, [this, devicePath, identity]() {
+        if (isKnownPath(devicePath)) {
             return;
         }
 
-        USBDevice *device = createDeviceFromPath(devicePath);
-        if (device) {
-            devices.push_back(device);
-        }
+        bringUpDevice(devicePath, [this, devicePath, identity]() {
+            return createDeviceFromPath(devicePath, identity);
+        });
     });
 }
 
 void USBController::enumerateDevices() {
-    if (!AppState::getInstance()->pluginInitialized) {
+    if (!AppState::getInstance()->pluginInitialized || !hidManager) {
         return;
     }
 
-    DIR *dir = opendir("/dev");
-    if (!dir) {
+    auto start = std::chrono::steady_clock::now();
+
+    // Own context: the monitor thread is using the controller's one concurrently.
+    struct udev *udev = udev_new();
+    struct udev_enumerate *enumerate = udev ? udev_enumerate_new(udev) : nullptr;
+    if (!enumerate) {
+        debug_force("Failed to create udev enumerator\n");
+        if (udev) {
+            udev_unref(udev);
+        }
         return;
     }
 
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != nullptr) {
-        if (strncmp(entry->d_name, "hidraw", 6) == 0) {
-            std::string devicePath = "/dev/" + std::string(entry->d_name);
-            addDeviceFromPath(devicePath);
+    udev_enumerate_add_match_subsystem(enumerate, "hidraw");
+    udev_enumerate_scan_devices(enumerate);
+
+    int hidrawCount = 0;
+    int matchCount = 0;
+    struct udev_list_entry *entry;
+    udev_list_entry_foreach(entry, udev_enumerate_get_list_entry(enumerate)) {
+        struct udev_device *device = udev_device_new_from_syspath(udev, udev_list_entry_get_name(entry));
+        if (!device) {
+            continue;
+        }
+
+        hidrawCount++;
+        const char *devicePath = udev_device_get_devnode(device);
+        if (devicePath && isWinwingDevice(device)) {
+            matchCount++;
+            addDeviceFromPath(std::string(devicePath), identityForDevice(device));
         }
+        udev_device_unref(device);
     }
-    closedir(dir);
+    udev_enumerate_unref(enumerate);
+    udev_unref(udev);
+
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    debug("Enumerated %d hidraw nodes (%d Winwing) in %.2f ms\n", hidrawCount, matchCount, elapsed);
 }
 
 void USBController::monitorDevices() {
-    if (!AppState::getInstance()->pluginInitialized || shouldStopMonitoring) {
+    if (!AppState::getInstance()->pluginInitialized) {
         return;
     }
 
-    int fd = udev_monitor_get_fd(hidManager);
-    while (!shouldStopMonitoring) {
-        fd_set fds;
-        FD_ZERO(&fds);
-        FD_SET(fd, &fds);
+    struct pollfd fds[2] = {{udev_monitor_get_fd(hidManager), POLLIN, 0}, {monitorWakeFd, POLLIN, 0}};
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            debug_force("Device monitor poll failed: %s\n", strerror(errno));
+            break;
+        }
 
-        struct timeval timeout = {1, 0};
-        int ret = select(fd + 1, &fds, nullptr, nullptr, &timeout);
+        if (fds[1].revents) {
+            // Woken by destroy()
+            break;
+        }
 
-        if (ret > 0 && FD_ISSET(fd, &fds) && !shouldStopMonitoring) {
+        if (fds[0].revents & POLLIN) {
             struct udev_device *device = udev_monitor_receive_device(hidManager);
             if (device) {
                 const char *action = udev_device_get_action(device);
-                if (strcmp(action, "add") == 0) {
+                if (action && strcmp(action, "add") == 0) {
                     DeviceAddedCallback(this, device);
-                } else if (strcmp(action, "remove") == 0) {
+                } else if (action && strcmp(action, "remove") == 0) {
                     DeviceRemovedCallback(this, device);
                 }
                 udev_device_unref(device);
@@ -185,11 +248,11 @@ void USBController::DeviceAddedCallback(void *context, struct udev_device *devic
     auto *self = static_cast<USBController *>(context);
 
     const char *devicePath = udev_device_get_devnode(device);
-    if (!devicePath) {
+    if (!devicePath || !isWinwingDevice(device)) {
         return;
     }
 
-    self->addDeviceFromPath(std::string(devicePath));
+    self->addDeviceFromPath(std::string(devicePath), identityForDevice(device));
 }
 
 void USBController::DeviceRemovedCallback(void *context, struct udev_device *device) {
@@ -200,48 +263,6 @@ void USBController::DeviceRemovedCallback(void *context, struct udev_device *dev
         return;
     }
 
-    // First pass: disconnect
-    for (auto it = self->devices.begin(); it != self->devices.end(); ++it) {
-        if ((*it)->hidDevice >= 0) {
-            char existingPath[256];
-            snprintf(existingPath, sizeof(existingPath), "/proc/self/fd/%d", (*it)->hidDevice);
-            char linkTarget[256];
-            ssize_t len = readlink(existingPath, linkTarget, sizeof(linkTarget) - 1);
-            if (len > 0) {
-                linkTarget[len] = '\0';
-                if (strcmp(linkTarget, devicePath) == 0) {
-                    (*it)->disconnect();
-                    break;
-                }
-            }
-        } else {
-            (*it)->disconnect();
-            break;
-        }
-    }
-
-    // Second pass: deferred erase
-    AppState::getInstance()->executeAfter(0, [self, devicePath = std::string(devicePath)]() {
-        for (auto it = self->devices.begin(); it != self->devices.end();) {
-            if (!(*it) || !(*it)->profileReady) {
-                delete *it;
-                it = self->devices.erase(it);
-            } else {
-                char existingPath[256];
-                snprintf(existingPath, sizeof(existingPath), "/proc/self/fd/%d", (*it)->hidDevice);
-                char linkTarget[256];
-                ssize_t len = readlink(existingPath, linkTarget, sizeof(linkTarget) - 1);
-                if (len > 0) {
-                    linkTarget[len] = '\0';
-                    if (strcmp(linkTarget, devicePath.c_str()) == 0) {
-                        delete *it;
-                        it = self->devices.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
-        }
-    });
+    self->scheduleRemoval(devicePath);
 }
 #endif
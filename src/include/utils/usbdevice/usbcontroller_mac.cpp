@@ -70,10 +70,10 @@ void USBController::enumerateDevices() {
 }
 
 void USBController::destroy() {
-    for (auto ptr : devices) {
-        delete ptr;
-    }
-    devices.clear();
+    disconnectAllDevices();
+
+    // The plugin is going away, so bring-ups still running have to be waited for here
+    deleteAbandonedDevices(true);
 
     if (hidManager) {
         IOHIDManagerClose(hidManager, kIOHIDOptionsTypeNone);
@@ -84,13 +84,11 @@ void USBController::destroy() {
     instance = nullptr;
 }
 
-bool USBController::deviceExistsWithHIDDevice(IOHIDDeviceRef device) {
-    for (auto *dev : devices) {
-        if (dev->hidDevice == device) {
-            return true;
-        }
-    }
-    return false;
+// IOHIDDeviceRefs are not paths, but the same ref is handed to both the matching and the removal callback.
+std::string USBController::DevicePath(IOHIDDeviceRef device) {
+    char path[32];
+    snprintf(path, sizeof(path), "IOHIDDevice:%p", (void *) device);
+    return std::string(path);
 }
 
 void USBController::DeviceAddedCallback(void *context, IOReturn result, void *sender, IOHIDDeviceRef device) {
@@ -99,20 +97,22 @@ void USBController::DeviceAddedCallback(void *context, IOReturn result, void *se
     }
 
     auto *self = static_cast<USBController *>(context);
-
-    for (auto *dev : self->devices) {
-        if (dev->hidDevice == device) {
-            return;
-        }
+    std::string devicePath = DevicePath(device);
+    if (self->isKnownPath(devicePath)) {
+        return;
     }
 
     int vendorId = 0, productId = 0;
+    int locationId = 0;
+    char serialBuf[256] = {0};
     char vendorNameBuf[256] = {0};
     char productNameBuf[256] = {0};
     CFTypeRef vidRef = IOHIDDeviceGetProperty(device, CFSTR(kIOHIDVendorIDKey));
     CFTypeRef pidRef = IOHIDDeviceGetProperty(device, CFSTR(kIOHIDProductIDKey));
     CFTypeRef vendorNameRef = IOHIDDeviceGetProperty(device, CFSTR(kIOHIDManufacturerKey));
     CFTypeRef productNameRef = IOHIDDeviceGetProperty(device, CFSTR(kIOHIDProductKey));
+    CFTypeRef locationRef = IOHIDDeviceGetProperty(device, CFSTR(kIOHIDLocationIDKey));
+    CFTypeRef serialRef = IOHIDDeviceGetProperty(device, CFSTR(kIOHIDSerialNumberKey));
     if (vidRef && CFGetTypeID(vidRef) == CFNumberGetTypeID()) {
         CFNumberGetValue((CFNumberRef) vidRef, kCFNumberIntType, &vendorId);
     }
@@ -125,6 +125,16 @@ void USBController::DeviceAddedCallback(void *context, IOReturn result, void *se
     if (productNameRef && CFGetTypeID(productNameRef) == CFStringGetTypeID()) {
         CFStringGetCString((CFStringRef) productNameRef, productNameBuf, sizeof(productNameBuf), kCFStringEncodingUTF8);
     }
+    if (locationRef && CFGetTypeID(locationRef) == CFNumberGetTypeID()) {
+        CFNumberGetValue((CFNumberRef) locationRef, kCFNumberIntType, &locationId);
+    }
+    if (serialRef && CFGetTypeID(serialRef) == CFStringGetTypeID()) {
+        CFStringGetCString((CFStringRef) serialRef, serialBuf, sizeof(serialBuf), kCFStringEncodingUTF8);
+    }
+
+    char locationBuf[16];
+    snprintf(locationBuf, sizeof(locationBuf), "%08x", locationId);
+    std::string identity = USBDevice::IdentityKey(vendorId, productId, locationBuf, serialBuf);
 
     std::string vendorNameStr = std::string(vendorNameBuf);
     std::string productNameStr = std::string(productNameBuf);
@@ -133,14 +143,14 @@ void USBController::DeviceAddedCallback(void *context, IOReturn result, void *se
     productNameStr.erase(0, productNameStr.find_first_not_of(" \t\n\r"));
     productNameStr.erase(productNameStr.find_last_not_of(" \t\n\r") + 1);
 
-    AppState::getInstance()->executeAfter(0, [self, device, vendorId, productId, vendorNameStr, productNameStr]() {
-        if (self->deviceExistsWithHIDDevice(device)) {
+    AppState::getInstance()->executeAfter(0, [self, device, devicePath, identity, vendorId, productId, vendorNameStr, productNameStr]() {
+        if (self->isKnownPath(devicePath)) {
             return;
         }
 
-        USBDevice *newDevice = USBDevice::Device(device, vendorId, productId, vendorNameStr, productNameStr);
+        USBDevice *newDevice = USBDevice::Device(device, vendorId, productId, vendorNameStr, productNameStr, identity);
         if (newDevice) {
-            self->devices.push_back(newDevice);
+            self->registerDevice(newDevice, devicePath);
         }
     });
 }
@@ -151,24 +161,11 @@ void USBController::DeviceRemovedCallback(void *context, IOReturn result, void *
     }
 
     auto *self = static_cast<USBController *>(context);
-    for (auto it = self->devices.begin(); it != self->devices.end(); ) {
-        if ((*it)->hidDevice == device) {
-            (*it)->disconnect();
-            ++it;
-        } else {
-            ++it;
-        }
+    std::string devicePath = DevicePath(device);
+    if (USBDevice *removed = self->deviceAtPath(devicePath)) {
+        removed->disconnect();
     }
 
-    AppState::getInstance()->executeAfter(0, [self, device]() {
-        for (auto it = self->devices.begin(); it != self->devices.end();) {
-            if ((*it)->hidDevice == device || !(*it)->profileReady) {
-                delete *it;
-                it = self->devices.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    });
+    self->scheduleRemoval(devicePath);
 }
 #endif
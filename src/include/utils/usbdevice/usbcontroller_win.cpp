@@ -1,6 +1,7 @@
 #if IBM
 #include "appstate.h"
 #include "config.h"
+#include "threadpolicy.h"
 #include "usbcontroller.h"
 #include "usbdevice.h"
 
@@ -9,9 +10,9 @@
 #include <hidsdi.h>
 #include <initguid.h>
 #include <iostream>
-#include <map>
 #include <setupapi.h>
 #include <thread>
+#include <unordered_set>
 #include <windows.h>
 
 // HID device interface GUID
@@ -19,21 +20,20 @@ DEFINE_GUID(GUID_DEVINTERFACE_HID, 0x4D1E55B2, 0xF16F, 0x11CF, 0x88, 0xCB, 0x00,
 
 USBController *USBController::instance = nullptr;
 
-// Map to track device paths since we can't modify USBDevice
-static std::map<USBDevice *, std::string> devicePaths;
-
 USBController::USBController() {
     enumerateDevices();
 
-    std::thread monitorThread([this]() {
-        while (!shouldShutdown) {
-            std::this_thread::sleep_for(std::chrono::seconds(5));
-            if (!shouldShutdown) {
-                checkForDeviceChanges();
-            }
+    monitorThread = std::thread([this]() {
+        ThreadPolicy::Apply(ThreadRole::DeviceMonitor);
+        std::unique_lock<std::mutex> lock(monitorMutex);
+        while (!monitorWake.wait_for(lock, std::chrono::seconds(5), [this]() {
+            return shouldShutdown;
+        })) {
+            lock.unlock();
+            checkForDeviceChanges();
+            lock.lock();
         }
     });
-    monitorThread.detach();
 }
 
 USBController::~USBController() {
@@ -48,15 +48,20 @@ USBController *USBController::getInstance() {
 }
 
 void USBController::destroy() {
-    shouldShutdown = true;
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        std::lock_guard<std::mutex> lock(monitorMutex);
+        shouldShutdown = true;
+    }
+    monitorWake.notify_all();
 
-    for (auto ptr : devices) {
-        devicePaths.erase(ptr); // Clean up our map
-        delete ptr;
+    if (monitorThread.joinable()) {
+        monitorThread.join();
     }
-    devices.clear();
+
+    disconnectAllDevices();
+
+    // The plugin is going away, so bring-ups still running have to be waited for here
+    deleteAbandonedDevices(true);
 
     instance = nullptr;
 }
@@ -80,30 +85,19 @@ USBDevice *USBController::createDeviceFromHandle(HANDLE hidDevice, const std::st
     WideCharToMultiByte(CP_UTF8, 0, vendorName, -1, vendorNameA, sizeof(vendorNameA), nullptr, nullptr);
     WideCharToMultiByte(CP_UTF8, 0, productName, -1, productNameA, sizeof(productNameA), nullptr, nullptr);
 
-    USBDevice *device = USBDevice::Device(hidDevice, attributes.VendorID, attributes.ProductID, std::string(vendorNameA), std::string(productNameA));
-
-    if (device) {
-        devicePaths[device] = devicePath;
+    // The interface path already encodes the port the unit is plugged into
+    wchar_t serial[128] = {};
+    char serialA[128] = {};
+    if (HidD_GetSerialNumberString(hidDevice, serial, sizeof(serial))) {
+        WideCharToMultiByte(CP_UTF8, 0, serial, -1, serialA, sizeof(serialA), nullptr, nullptr);
     }
-    return device;
-}
+    std::string identity = USBDevice::IdentityKey(attributes.VendorID, attributes.ProductID, devicePath, std::string(serialA));
 
-bool USBController::deviceExistsWithPath(const std::string &devicePath) {
-    for (const auto &pair : devicePaths) {
-        if (pair.second == devicePath) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool USBController::deviceExistsWithHandle(HANDLE hidDevice) {
-    for (auto *dev : devices) {
-        if (dev->hidDevice == hidDevice) {
-            return true;
-        }
+    USBDevice *device = USBDevice::Device(hidDevice, attributes.VendorID, attributes.ProductID, std::string(vendorNameA), std::string(productNameA), identity);
+    if (!device) {
+        CloseHandle(hidDevice);
     }
-    return false;
+    return device;
 }
 
 void USBController::addDeviceFromHandle(HANDLE hidDevice, const std::string &devicePath) {
@@ -111,16 +105,15 @@ void USBController::addDeviceFromHandle(HANDLE hidDevice, const std::string &dev
         return;
     }
 
-    if (deviceExistsWithPath(devicePath)) {
-        CloseHandle(hidDevice);
-        return;
-    }
-
     AppState::getInstance()->executeAfter(0, [this, hidDevice, devicePath]() {
-        USBDevice *device = createDeviceFromHandle(hidDevice, devicePath);
-        if (device) {
-            devices.push_back(device);
+        if (isKnownPath(devicePath)) {
+            CloseHandle(hidDevice);
+            return;
         }
+
+        bringUpDevice(devicePath, [this, hidDevice, devicePath]() {
+            return createDeviceFromHandle(hidDevice, devicePath);
+        });
     });
 }
 
@@ -145,7 +138,7 @@ void USBController::enumerateHidDevices(std::function<void(HANDLE, const std::st
         deviceDetail->cbSize = sizeof(SP_DEVICE_INTERFACE_DETAIL_DATA);
 
         if (SetupDiGetDeviceInterfaceDetail(deviceInfoSet, &deviceInterfaceData, deviceDetail, requiredSize, nullptr, nullptr)) {
-            HANDLE hidDevice = CreateFile(deviceDetail->DevicePath, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr);
+            HANDLE hidDevice = CreateFile(deviceDetail->DevicePath, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr);
             if (hidDevice != INVALID_HANDLE_VALUE) {
                 deviceHandler(hidDevice, std::string(deviceDetail->DevicePath));
             }
@@ -162,54 +155,30 @@ void USBController::enumerateDevices() {
 }
 
 void USBController::checkForDeviceChanges() {
-    std::vector<std::string> currentDevicePaths;
+    std::unordered_set<std::string> currentDevicePaths;
 
     enumerateHidDevices([this, &currentDevicePaths](HANDLE hidDevice, const std::string &devicePath) {
         HIDD_ATTRIBUTES attributes = {};
         attributes.Size = sizeof(attributes);
         if (HidD_GetAttributes(hidDevice, &attributes) && attributes.VendorID == WINWING_VENDOR_ID) {
-            currentDevicePaths.push_back(devicePath);
+            currentDevicePaths.insert(devicePath);
             addDeviceFromHandle(hidDevice, devicePath);
         } else {
             CloseHandle(hidDevice);
         }
     });
 
-    // First pass: disconnect stale devices
-    for (auto *dev : devices) {
-        auto pathIt = devicePaths.find(dev);
-        bool found = false;
-        if (pathIt != devicePaths.end()) {
-            found = std::find(currentDevicePaths.begin(), currentDevicePaths.end(), pathIt->second) != currentDevicePaths.end();
-        }
-        if (!found || dev->hidDevice == INVALID_HANDLE_VALUE || !dev->connected) {
-            dev->disconnect();
+    // The registry is only touched from the main thread
+    AppState::getInstance()->executeAfter(0, [this, currentDevicePaths = std::move(currentDevicePaths)]() {
+        std::vector<USBDevice *> stale;
+        for (auto *dev : devices) {
+            if (!currentDevicePaths.contains(dev->devicePath) || dev->hidDevice == INVALID_HANDLE_VALUE || !dev->connected) {
+                stale.push_back(dev);
+            }
         }
-    }
 
-    // Second pass: deferred erase
-    AppState::getInstance()->executeAfter(0, [this]() {
-        for (auto it = devices.begin(); it != devices.end();) {
-            auto pathIt = devicePaths.find(*it);
-            bool remove = false;
-            if (!(*it)->profileReady || (*it)->hidDevice == INVALID_HANDLE_VALUE || !(*it)->connected) {
-                remove = true;
-            }
-            if (pathIt != devicePaths.end() &&
-                std::find_if(devices.begin(), devices.end(), [&](USBDevice *d) {
-                    return devicePaths[d] == pathIt->second;
-                }) == devices.end()) {
-                remove = true;
-            }
-            if (remove) {
-                if (pathIt != devicePaths.end()) {
-                    devicePaths.erase(pathIt);
-                }
-                delete *it;
-                it = devices.erase(it);
-            } else {
-                ++it;
-            }
+        for (auto *dev : stale) {
+            removeDevice(dev, !currentDevicePaths.contains(dev->devicePath));
         }
     });
 }
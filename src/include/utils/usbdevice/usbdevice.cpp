@@ -1,14 +1,49 @@
 #include "usbdevice.h"
 
 #include "appstate.h"
+#include "hidcapture.h"
+#include "threadpolicy.h"
+#include "usbcontroller.h"
 #include "product-fcu-efis.h"
 #include "product-fmc.h"
 #include "pap3_device.h"
 #include "product-ursa-minor-joystick.h"
 
+#include <algorithm>
 #include <XPLMUtilities.h>
 
-USBDevice *USBDevice::Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) {
+namespace {
+    // A device that fails this many writes in a row, backing off in between, is considered lost
+    constexpr int lostAfterWriteFailures = 6;
+    constexpr std::chrono::milliseconds initialWriteBackoff(10);
+    constexpr std::chrono::milliseconds maxWriteBackoff(500);
+
+    // How long writeReport() waits for room in a full lane. One that stays full this long belongs
+    // to a device that stopped taking reports, and the caller is often the main thread.
+    constexpr std::chrono::milliseconds maxQueueWait(50);
+
+    constexpr std::chrono::seconds initialReconnectInterval(1);
+    constexpr std::chrono::seconds maxReconnectInterval(30);
+
+    // Input reports waiting for the main thread. Past this (a long frame, a sim pause) the oldest are dropped.
+    constexpr size_t maxQueuedInputEvents = 256;
+}
+
+bool LogRateLimiter::allow(int &suppressedSinceLast, std::chrono::seconds interval) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto now = std::chrono::steady_clock::now();
+    if (lastLogged != std::chrono::steady_clock::time_point() && now - lastLogged < interval) {
+        suppressed++;
+        return false;
+    }
+
+    suppressedSinceLast = suppressed;
+    suppressed = 0;
+    lastLogged = now;
+    return true;
+}
+
+USBDevice *USBDevice::Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity) {
     if (vendorId != WINWING_VENDOR_ID) {
         debug("Vendor ID mismatch: 0x%04X != 0x%04X\n", vendorId, WINWING_VENDOR_ID);
         return nullptr;
@@ -17,51 +52,68 @@ USBDevice *USBDevice::Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint1
     switch (productId) {
         case 0xBC27: // URSA MINOR Airline Joystick L
         case 0xBC28: // URSA MINOR Airline Joystick R
-            return new ProductUrsaMinorJoystick(hidDevice, vendorId, productId, vendorName, productName);
+            return new ProductUrsaMinorJoystick(hidDevice, vendorId, productId, vendorName, productName, identity);
 
         case 0xBB36:   // MCDU-32 (Captain)
         case 0xBB3E:   // MCDU-32 (First Officer)
         case 0xBB3A: { // MCDU-32 (Observer)
             constexpr uint8_t identifierByte = 0x32;
-            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_MCDU, identifierByte);
+            FMCSide side = productId == 0xBB36 ? FMCSide::Captain : productId == 0xBB3E ? FMCSide::FirstOfficer : FMCSide::Observer;
+            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_MCDU, side, identifierByte, identity);
         }
 
         case 0xBB35:   // PFP 3N (Captain)
         case 0xBB39:   // PFP 3N (First Officer)
         case 0xBB3D: { // PFP 3N (Observer)
             constexpr uint8_t identifierByte = 0x31;
-            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_PFP3N, identifierByte);
+            FMCSide side = productId == 0xBB35 ? FMCSide::Captain : productId == 0xBB39 ? FMCSide::FirstOfficer : FMCSide::Observer;
+            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_PFP3N, side, identifierByte, identity);
         }
 
         case 0xBB38:   // PFP 4 (Captain)
         case 0xBB40:   // PFP 4 (First Officer)
         case 0xBB3C: { // PFP 4 (Observer)
             constexpr uint8_t identifierByte = 0x31;
-            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_PFP4, identifierByte);
+            FMCSide side = productId == 0xBB38 ? FMCSide::Captain : productId == 0xBB40 ? FMCSide::FirstOfficer : FMCSide::Observer;
+            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_PFP4, side, identifierByte, identity);
         }
 
         case 0xBB37:   // PFP 7 (Captain)
         case 0xBB3F:   // PFP 7 (First Officer)
         case 0xBB3B: { // PFP 7 (Observer)
             constexpr uint8_t identifierByte = 0x31;
-            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_PFP7, identifierByte);
+            FMCSide side = productId == 0xBB37 ? FMCSide::Captain : productId == 0xBB3F ? FMCSide::FirstOfficer : FMCSide::Observer;
+            return new ProductFMC(hidDevice, vendorId, productId, vendorName, productName, FMCHardwareType::HARDWARE_PFP7, side, identifierByte, identity);
         }
 
         case 0xBB10: // FCU only
         case 0xBC1E: // FCU + EFIS-R
         case 0xBC1D: // FCU + EFIS-L
         case 0xBA01: // FCU + EFIS-L + EFIS-R
-            return new ProductFCUEfis(hidDevice, vendorId, productId, vendorName, productName);
+            return new ProductFCUEfis(hidDevice, vendorId, productId, vendorName, productName, identity);
 
         case 0xBF0F: // PAP3-MCP
             debug_force("Detected PAP3 MCP device - vendorId: 0x%04X, productId: 0x%04X\n", vendorId, productId);
-            return new pap3::device::PAP3Device(hidDevice, vendorId, productId, vendorName, productName);
+            return new pap3::device::PAP3Device(hidDevice, vendorId, productId, vendorName, productName, identity);
         default:
             debug_force("Unknown Winwing device - vendorId: 0x%04X, productId: 0x%04X\n", vendorId, productId);
             return nullptr;
     }
 }
 
+const char *USBDevice::HealthName(USBDeviceHealth health) {
+    switch (health) {
+        case USBDeviceHealth::Healthy:
+            return "healthy";
+        case USBDeviceHealth::Degraded:
+            return "degraded";
+        case USBDeviceHealth::Lost:
+            return "lost";
+    }
+
+    return "unknown";
+}
+
 const char *USBDevice::classIdentifier() {
     return "USBDevice (none)";
 }
@@ -70,9 +122,207 @@ void USBDevice::didReceiveData(int reportId, uint8_t *report, int reportLength)
     // noop, expect override
 }
 
+std::string USBDevice::IdentityKey(uint16_t vendorId, uint16_t productId, const std::string &busPath, const std::string &serial) {
+    char ids[16];
+    snprintf(ids, sizeof(ids), "%04x:%04x", vendorId, productId);
+    return std::string(ids) + "@" + busPath + "#" + serial;
+}
+
+void USBDevice::withRetainedState(const std::function<void(USBDeviceRetainedState &)> &access) {
+    USBController::getInstance()->withRetainedState(identity, access);
+}
+
+void USBDevice::unloadProfile() {
+    // noop, expect override
+}
+
+void USBDevice::publishSettings(const std::string &deviceName) {
+    // noop, expect override
+}
+
+bool USBDevice::writeReport(std::span<const uint8_t> report, USBWritePriority priority) {
+    USBDeviceHealth currentHealth = health;
+    if (currentHealth == USBDeviceHealth::Lost) {
+        // Dropped quietly, markLost() already said so once
+        stats.countOutputDrop();
+        return false;
+    }
+
+    if (!connected) {
+        debug("Not queueing report for %s: device not connected\n", classIdentifier());
+        return false;
+    }
+
+    if (currentHealth == USBDeviceHealth::Degraded) {
+        // The output thread is backing off, don't let a full queue stall the caller
+        if (!outputQueue.push(report, priority, std::chrono::milliseconds(0))) {
+            stats.countOutputDrop();
+            return false;
+        }
+        return true;
+    }
+
+    if (!outputQueue.push(report, priority, maxQueueWait)) {
+        stats.countOutputDrop();
+
+        // Any thread can get here, and a device going away makes every caller fail at once
+        int suppressed = 0;
+        if (queueFailureLog.allow(suppressed)) {
+            debug_force("Could not queue report of %zu bytes for %s (%d similar errors suppressed)\n", report.size(), classIdentifier(), suppressed);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+bool USBDevice::writeData(const std::vector<uint8_t> &data, USBWritePriority priority) {
+    return writeReport(data, priority);
+}
+
+bool USBDevice::hasPendingWrites(USBWritePriority priority) {
+    return outputQueue.pendingCount(priority) > 0;
+}
+
+void USBDevice::startOutputThread() {
+    stopOutputThread();
+
+    outputQueue.open();
+    outputThread = std::thread([this]() {
+        ThreadPolicy::Apply(ThreadRole::DeviceOutput);
+        OutputReport report;
+        while (outputQueue.pop(report)) {
+            if (health == USBDeviceHealth::Lost) {
+                writeFailed = true;
+                continue;
+            }
+
+            auto writeStart = std::chrono::steady_clock::now();
+            if (transmitReport({report.data.data(), report.length})) {
+                stats.countWrite(report.length, std::chrono::steady_clock::now() - writeStart);
+                if (HIDCapture::getInstance()->isActive()) {
+                    HIDCapture::getInstance()->record(this, HIDCaptureRecordType::Output, {report.data.data(), report.length});
+                }
+                noteWriteSucceeded();
+                continue;
+            }
+
+            stats.countFailedWrite();
+            writeFailed = true;
+
+            if (outputQueue.isClosed()) {
+                // Device is going away; don't retry every remaining packet against a dead handle.
+                outputQueue.discardPending();
+                continue;
+            }
+
+            std::chrono::milliseconds backoff = noteWriteFailed();
+            if (health == USBDeviceHealth::Lost) {
+                outputQueue.discardPending();
+            } else {
+                outputQueue.waitUntilClosed(backoff);
+            }
+        }
+    });
+}
+
+std::chrono::milliseconds USBDevice::noteWriteFailed() {
+    consecutiveWriteFailures++;
+    if (consecutiveWriteFailures >= lostAfterWriteFailures) {
+        markLost();
+        return std::chrono::milliseconds(0);
+    }
+
+    USBDeviceHealth expected = USBDeviceHealth::Healthy;
+    health.compare_exchange_strong(expected, USBDeviceHealth::Degraded);
+    return std::min(initialWriteBackoff * (1 << (consecutiveWriteFailures - 1)), maxWriteBackoff);
+}
+
+void USBDevice::noteWriteSucceeded() {
+    if (consecutiveWriteFailures == 0) {
+        return;
+    }
+
+    consecutiveWriteFailures = 0;
+    USBDeviceHealth expected = USBDeviceHealth::Degraded;
+    if (health.compare_exchange_strong(expected, USBDeviceHealth::Healthy)) {
+        debug("%s recovered, writes are going through again\n", classIdentifier());
+    }
+}
+
+bool USBDevice::takeWriteFailure() {
+    return writeFailed.exchange(false);
+}
+
+void USBDevice::markLost() {
+    if (health.exchange(USBDeviceHealth::Lost) != USBDeviceHealth::Lost) {
+        debug_force("%s stopped responding, dropping writes until it is reopened\n", classIdentifier());
+    }
+}
+
+bool USBDevice::reconnectDue() {
+    if (health != USBDeviceHealth::Lost) {
+        return false;
+    }
+
+    if (!reconnectScheduled) {
+        reconnectScheduled = true;
+        reconnectInterval = initialReconnectInterval;
+        nextReconnectAttempt = std::chrono::steady_clock::now() + reconnectInterval;
+        return false;
+    }
+
+    return std::chrono::steady_clock::now() >= nextReconnectAttempt;
+}
+
+bool USBDevice::reconnect() {
+    // The unit may have been power cycled, so don't trust anything it was holding
+    withRetainedState([](USBDeviceRetainedState &state) {
+        state.residentContent.clear();
+    });
+
+    // The product's own teardown first, so it forgets what it sent to the unit
+    HIDDeviceHandle previousHandle = hidDevice;
+    disconnect();
+
+    if (reopen(previousHandle)) {
+        // disconnect() stopped the output thread, so its failure count is ours to reset
+        consecutiveWriteFailures = 0;
+        health = USBDeviceHealth::Healthy;
+        if (connect()) {
+            debug_force("%s reconnected at %s\n", classIdentifier(), devicePath.c_str());
+            reconnectScheduled = false;
+            return true;
+        }
+        health = USBDeviceHealth::Lost;
+    }
+
+    reconnectInterval = std::min(reconnectInterval * 2, maxReconnectInterval);
+    nextReconnectAttempt = std::chrono::steady_clock::now() + reconnectInterval;
+    debug("Could not reopen %s, retrying in %lld s\n", classIdentifier(), (long long) reconnectInterval.count());
+    return false;
+}
+
+void USBDevice::stopOutputThread() {
+    outputQueue.close();
+    if (outputThread.joinable()) {
+        outputThread.join();
+    }
+}
+
 void USBDevice::processOnMainThread(const InputEvent &event) {
+    stats.countInputReport();
+    if (HIDCapture::getInstance()->isActive()) {
+        HIDCapture::getInstance()->record(this, HIDCaptureRecordType::Input, event.reportData);
+    }
+
     std::lock_guard<std::mutex> lock(eventQueueMutex);
+    if (eventQueue.size() >= maxQueuedInputEvents) {
+        eventQueue.pop();
+        stats.countInputDrop();
+    }
     eventQueue.push(event);
+    stats.noteInputQueueDepth(eventQueue.size());
 }
 
 void USBDevice::processQueuedEvents() {
@@ -2,11 +2,19 @@
 #define USBDEVICE_H
 
 #include "config.h"
+#include "usbdevicestats.h"
+#include "usboutputqueue.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <mutex>
 #include <queue>
+#include <span>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #if APL
@@ -18,10 +26,33 @@ typedef IOHIDDeviceRef HIDDeviceHandle;
 #include <windows.h>
 typedef HANDLE HIDDeviceHandle;
 #elif LIN
-#include <linux/hidraw.h>
-typedef int HIDDeviceHandle;
+#include "hidtransport.h"
+typedef HIDTransport *HIDDeviceHandle; // Owned by the device
 #endif
 
+// State that belongs to a physical unit rather than to one connection. USBController keeps
+// one per device identity, so it is still there after a device reload or a replug.
+struct USBDeviceRetainedState {
+        // What the unit holds in its own memory (fonts, ...) by slot, as a content hash.
+        // Dropped when the unit is unplugged, since it loses it with power.
+        std::unordered_map<std::string, uint64_t> residentContent;
+};
+
+enum class USBDeviceHealth : unsigned char {
+    Healthy,  // Writes go through
+    Degraded, // Recent writes failed, the output thread backs off between attempts
+    Lost,     // Writes are dropped until the controller manages to reconnect the device
+};
+
+// Lets a repeating log line through at most once per interval and counts what it held back.
+struct LogRateLimiter {
+        std::mutex mutex;
+        std::chrono::steady_clock::time_point lastLogged;
+        int suppressed = 0;
+
+        bool allow(int &suppressedSinceLast, std::chrono::seconds interval = std::chrono::seconds(5));
+};
+
 struct InputEvent {
         int reportId;
         std::vector<uint8_t> reportData;
@@ -33,8 +64,40 @@ class USBDevice {
         uint8_t *inputBuffer = nullptr;
         std::queue<InputEvent> eventQueue;
         std::mutex eventQueueMutex;
+        USBOutputQueue outputQueue;
+        std::thread outputThread;
+        std::thread inputThread;
+#if APL
+        CFRunLoopRef inputRunLoop = nullptr; // Where input is scheduled, retained until it is unscheduled
+#elif IBM
+        HANDLE inputWakeEvent = nullptr;
+#elif LIN
+        std::atomic<bool> inputStopRequested = false;
+#endif
+
+        // Set by the output thread when a queued report does not make it out, see takeWriteFailure()
+        std::atomic<bool> writeFailed = false;
+
+        // Output thread only
+        int consecutiveWriteFailures = 0;
+        LogRateLimiter writeFailureLog;
+
+        LogRateLimiter queueFailureLog;
+
+        // Main thread, or the reconnect worker while it has the device
+        bool reconnectScheduled = false;
+        std::chrono::steady_clock::time_point nextReconnectAttempt;
+        std::chrono::seconds reconnectInterval{0};
 
         void processQueuedEvents();
+        void startOutputThread();
+        void stopOutputThread();
+        void stopInputThread();
+        bool transmitReport(std::span<const uint8_t> report);
+        std::chrono::milliseconds noteWriteFailed();
+        void noteWriteSucceeded();
+        void markLost();
+        bool reopen(HIDDeviceHandle previousHandle);
 
 #if APL
         static void InputReportCallback(void *context, IOReturn result, void *sender, IOHIDReportType type, uint32_t reportID, uint8_t *report, CFIndex reportLength);
@@ -45,28 +108,62 @@ class USBDevice {
 #endif
 
     public:
-        USBDevice(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName);
+        USBDevice(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity);
         virtual ~USBDevice();
 
         HIDDeviceHandle hidDevice;
-        bool connected = false;
+        std::atomic<bool> connected = false;
+        std::atomic<USBDeviceHealth> health = USBDeviceHealth::Healthy;
+        USBDeviceStats stats;
         bool profileReady = false;
         uint16_t vendorId;
         uint16_t productId;
         std::string vendorName;
         std::string productName;
+        std::string identity;   // Stable across replugs, see IdentityKey()
+        std::string devicePath; // Where the OS currently exposes the device, set by USBController
 
         virtual const char *classIdentifier();
         virtual bool connect();
         virtual void disconnect();
         virtual void update();
+        virtual void unloadProfile();
         virtual void didReceiveData(int reportId, uint8_t *report, int reportLength);
 
         void processOnMainThread(const InputEvent &event);
 
-        bool writeData(std::vector<uint8_t> data);
+        // Main thread. Datarefs for this unit's own settings, under winwing/settings/<deviceName>/,
+        // published by USBController under the same name as the stats.
+        virtual void publishSettings(const std::string &deviceName);
+
+        // Main thread, every frame: whether the device is lost and due for another reopen attempt
+        bool reconnectDue();
+
+        // Runs the product's disconnect() and connect() again on a reopened handle. Blocks on the
+        // device, so USBController runs it on a worker thread with the device out of the registry.
+        bool reconnect();
+
+        // Whether any report accepted by writeReport() failed or was dropped since the last call
+        bool takeWriteFailure();
+        void withRetainedState(const std::function<void(USBDeviceRetainedState &)> &access);
+
+        // Asks the device for its current input report instead of waiting for it to send one.
+        // The answer goes through didReceiveData() on the main thread like any other report.
+        bool requestInputReport(uint8_t reportId);
+
+        // Hands a report to the input path as if the device had sent it (HIDReplay)
+        void replayInputReport(std::span<const uint8_t> report);
+
+        // Returns true once the report is in the output queue, not once it reached the device. A report
+        // that finds its lane full for too long is dropped instead of holding up the caller. Reports
+        // that fail after that are counted in stats and reported by takeWriteFailure().
+        bool writeReport(std::span<const uint8_t> report, USBWritePriority priority = USBWritePriority::Interactive);
+        bool writeData(const std::vector<uint8_t> &data, USBWritePriority priority = USBWritePriority::Interactive);
+        bool hasPendingWrites(USBWritePriority priority);
 
-        static USBDevice *Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName);
+        static USBDevice *Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, std::string identity);
+        static const char *HealthName(USBDeviceHealth health);
+        static std::string IdentityKey(uint16_t vendorId, uint16_t productId, const std::string &busPath, const std::string &serial);
 };
 
 #endif
@@ -1,25 +1,23 @@
 #if LIN
 #include "appstate.h"
 #include "config.h"
+#include "threadpolicy.h"
 #include "usbdevice.h"
 
 #include <atomic>
 #include <chrono>
 #include <cstring>
-#include <errno.h>
-#include <fcntl.h>
 #include <iostream>
-#include <linux/hidraw.h>
-#include <sys/ioctl.h>
 #include <thread>
-#include <unistd.h>
 #include <XPLMUtilities.h>
 
-USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName) :
-    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), connected(false) {}
+USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName, std::string aIdentity) :
+    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), identity(aIdentity), connected(false) {}
 
 USBDevice::~USBDevice() {
     disconnect();
+    delete hidDevice;
+    hidDevice = nullptr;
 }
 
 bool USBDevice::connect() {
@@ -30,28 +28,41 @@ bool USBDevice::connect() {
     }
     inputBuffer = new uint8_t[kInputReportSize];
 
+    if (!hidDevice || !hidDevice->open()) {
+        debug_force("Failed to open %s: %s\n", hidDevice ? hidDevice->name().c_str() : productName.c_str(), hidDevice ? hidDevice->lastError() : "no transport");
+        return false;
+    }
+
+    stopInputThread();
     connected = true;
-    std::thread inputThread([this]() {
+    startOutputThread();
+    inputThread = std::thread([this, transport = hidDevice]() {
+        ThreadPolicy::Apply(ThreadRole::DeviceInput);
         uint8_t buffer[65];
-        while (connected && hidDevice >= 0) {
-            ssize_t bytesRead = read(hidDevice, buffer, sizeof(buffer));
-            if (bytesRead > 0 && connected) {
-                InputReportCallback(this, (int) bytesRead, buffer);
-            } else if (bytesRead < 0) {
-                // Device error or disconnected
-                debug_force("Read failed with error: %d\n", errno);
-                break;
-            } else if (bytesRead == 0) {
-                // EOF - device disconnected
+        while (connected) {
+            int bytesRead = transport->read(buffer);
+            if (bytesRead == 0) {
+                // Interrupted; a leftover wake from an earlier reader is simply ignored
+                if (inputStopRequested) {
+                    break;
+                }
+                continue;
+            }
+
+            if (bytesRead < 0) {
+                // Device unplugged, reset or failing
+                debug_force("Read from %s failed: %s\n", transport->name().c_str(), transport->lastError());
+                markLost();
                 break;
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (connected) {
+                InputReportCallback(this, bytesRead, buffer);
+            }
         }
 
         debug("Input thread exiting\n");
     });
-    inputThread.detach();
 
     return true;
 }
@@ -84,14 +95,14 @@ void USBDevice::update() {
 }
 
 void USBDevice::disconnect() {
-    connected = false;
+    // Flush queued output while the device is still open
+    stopOutputThread();
 
-    // Give input thread time to exit
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    connected = false;
+    stopInputThread();
 
-    if (hidDevice >= 0) {
-        close(hidDevice);
-        hidDevice = -1;
+    if (hidDevice) {
+        hidDevice->close();
     }
 
     if (inputBuffer) {
@@ -102,18 +113,57 @@ void USBDevice::disconnect() {
     debug("Device disconnected\n");
 }
 
-bool USBDevice::writeData(std::vector<uint8_t> data) {
-    if (hidDevice < 0 || !connected || data.empty()) {
+bool USBDevice::requestInputReport(uint8_t reportId) {
+    if (!hidDevice || !connected) {
+        return false;
+    }
+
+    uint8_t buffer[65] = {};
+    int bytesRead = hidDevice->getInputReport(reportId, buffer);
+    if (bytesRead > 0) {
+        InputReportCallback(this, bytesRead, buffer);
+        return true;
+    }
+
+    debug("Reading input report 0x%02X from %s failed: %s\n", reportId, hidDevice->name().c_str(), hidDevice->lastError());
+    return false;
+}
+
+void USBDevice::replayInputReport(std::span<const uint8_t> report) {
+    std::vector<uint8_t> buffer(report.begin(), report.end());
+    InputReportCallback(this, (int) buffer.size(), buffer.data());
+}
+
+// The transport survives disconnect(), so opening it again reaches the same device node.
+bool USBDevice::reopen(HIDDeviceHandle previousHandle) {
+    return hidDevice && hidDevice->open();
+}
+
+void USBDevice::stopInputThread() {
+    if (!inputThread.joinable()) {
+        return;
+    }
+
+    inputStopRequested = true;
+    hidDevice->interruptRead();
+    inputThread.join();
+    inputStopRequested = false;
+}
+
+bool USBDevice::transmitReport(std::span<const uint8_t> report) {
+    if (!hidDevice || !hidDevice->isOpen() || !connected || report.empty()) {
         debug("HID device not open, not connected, or empty data\n");
         return false;
     }
 
-    ssize_t bytesWritten = write(hidDevice, data.data(), data.size());
-    if (bytesWritten == (ssize_t) data.size()) {
+    if (hidDevice->write(report)) {
         return true;
     }
 
-    debug_force("Raw write failed: %s (wrote %zd of %zu bytes)\n", strerror(errno), bytesWritten, data.size());
+    int suppressed = 0;
+    if (writeFailureLog.allow(suppressed)) {
+        debug_force("Write to %s failed: %s (%zu bytes, %d similar errors suppressed)\n", hidDevice->name().c_str(), hidDevice->lastError(), report.size(), suppressed);
+    }
     return false;
 }
 #endif
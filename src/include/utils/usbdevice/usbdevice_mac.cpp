@@ -8,15 +8,16 @@
 #include <iostream>
 #include <XPLMUtilities.h>
 
-USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName) :
-    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), connected(false) {}
+static const size_t kInputReportSize = 65;
+
+USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName, std::string aIdentity) :
+    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), identity(aIdentity), connected(false) {}
 
 USBDevice::~USBDevice() {
     disconnect();
 }
 
 bool USBDevice::connect() {
-    static const size_t kInputReportSize = 65;
     if (inputBuffer) {
         delete[] inputBuffer;
         inputBuffer = nullptr;
@@ -39,11 +40,14 @@ bool USBDevice::connect() {
     }
 
     IOHIDDeviceRegisterInputReportCallback(hidDevice, inputBuffer, kInputReportSize, &USBDevice::InputReportCallback, this);
+    // Input is handled on the main run loop, also when a reconnect runs this on a worker thread
     if (hidDevice) {
-        IOHIDDeviceScheduleWithRunLoop(hidDevice, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+        inputRunLoop = (CFRunLoopRef) CFRetain(CFRunLoopGetMain());
+        IOHIDDeviceScheduleWithRunLoop(hidDevice, inputRunLoop, kCFRunLoopDefaultMode);
     }
 
     connected = true;
+    startOutputThread();
     return true;
 }
 
@@ -80,18 +84,14 @@ void USBDevice::update() {
 }
 
 void USBDevice::disconnect() {
-    // Set connected to false first to prevent callback processing
+    // Flush queued output while the device is still open
+    stopOutputThread();
+
+    // Set connected to false to prevent callback processing
     connected = false;
+    stopInputThread();
 
     if (hidDevice) {
-        IOHIDDeviceUnscheduleFromRunLoop(hidDevice, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
-
-        // Force run loop to process any remaining queued callbacks to drain them
-        // This ensures any pending callbacks are processed while connected=false
-        for (int i = 0; i < 10; i++) {
-            CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.001, true);
-        }
-
         IOHIDDeviceClose(hidDevice, kIOHIDOptionsTypeNone);
         hidDevice = nullptr;
     }
@@ -102,16 +102,68 @@ void USBDevice::disconnect() {
     }
 }
 
-bool USBDevice::writeData(std::vector<uint8_t> data) {
-    if (!hidDevice || !connected || data.empty()) {
+bool USBDevice::requestInputReport(uint8_t reportId) {
+    if (!hidDevice || !connected) {
+        return false;
+    }
+
+    uint8_t buffer[kInputReportSize] = {reportId};
+    CFIndex length = sizeof(buffer);
+    IOReturn result = IOHIDDeviceGetReport(hidDevice, kIOHIDReportTypeInput, reportId, buffer, &length);
+    if (result != kIOReturnSuccess || length <= 0) {
+        debug("IOHIDDeviceGetReport failed for report 0x%02X: %d\n", reportId, result);
+        return false;
+    }
+
+    InputReportCallback(this, kIOReturnSuccess, hidDevice, kIOHIDReportTypeInput, reportId, buffer, length);
+    return true;
+}
+
+void USBDevice::replayInputReport(std::span<const uint8_t> report) {
+    if (report.empty()) {
+        return;
+    }
+
+    std::vector<uint8_t> buffer(report.begin(), report.end());
+    InputReportCallback(this, kIOReturnSuccess, hidDevice, kIOHIDReportTypeInput, buffer[0], buffer.data(), (CFIndex) buffer.size());
+}
+
+// There is no path to reopen on macOS, but the manager keeps the device object for as long as
+// the unit is attached, so handing it back after disconnect() lets connect() open it again.
+bool USBDevice::reopen(HIDDeviceHandle previousHandle) {
+    hidDevice = previousHandle;
+    return hidDevice != nullptr;
+}
+
+// Input arrives through the main run loop rather than a thread. Once the callback is
+// unregistered and the device unscheduled, nothing can call back into this object.
+void USBDevice::stopInputThread() {
+    if (!hidDevice || !inputBuffer) {
+        return;
+    }
+
+    IOHIDDeviceRegisterInputReportCallback(hidDevice, inputBuffer, kInputReportSize, nullptr, nullptr);
+    if (inputRunLoop) {
+        // Not necessarily the current one, disconnect() can run on another thread than connect()
+        IOHIDDeviceUnscheduleFromRunLoop(hidDevice, inputRunLoop, kCFRunLoopDefaultMode);
+        CFRelease(inputRunLoop);
+        inputRunLoop = nullptr;
+    }
+}
+
+bool USBDevice::transmitReport(std::span<const uint8_t> report) {
+    if (!hidDevice || !connected || report.empty()) {
         debug("HID device not open, not connected, or empty data\n");
         return false;
     }
 
-    uint8_t reportID = data[0];
-    IOReturn kr = IOHIDDeviceSetReport(hidDevice, kIOHIDReportTypeOutput, reportID, data.data(), data.size());
+    uint8_t reportID = report[0];
+    IOReturn kr = IOHIDDeviceSetReport(hidDevice, kIOHIDReportTypeOutput, reportID, report.data(), report.size());
     if (kr != kIOReturnSuccess) {
-        debug("IOHIDDeviceSetReport failed: %d\n", kr);
+        int suppressed = 0;
+        if (writeFailureLog.allow(suppressed)) {
+            debug("IOHIDDeviceSetReport failed: %d (%d similar errors suppressed)\n", kr, suppressed);
+        }
         return false;
     }
     return true;
@@ -1,9 +1,11 @@
 #if IBM
 #include "appstate.h"
 #include "config.h"
+#include "threadpolicy.h"
 #include "usbdevice.h"
 
 #include <chrono>
+#include <hidpi.h>
 #include <hidsdi.h>
 #include <iostream>
 #include <setupapi.h>
@@ -11,8 +13,8 @@
 #include <windows.h>
 #include <XPLMUtilities.h>
 
-USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName) :
-    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), connected(false) {}
+USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName, std::string aIdentity) :
+    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), identity(aIdentity), connected(false) {}
 
 USBDevice::~USBDevice() {
     disconnect();
@@ -26,26 +28,62 @@ bool USBDevice::connect() {
     }
     inputBuffer = new uint8_t[kInputReportSize];
 
-    // Start input reading thread with proper cleanup
+    stopInputThread();
+    inputWakeEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (!inputWakeEvent) {
+        debug_force("Failed to create input wake event: %lu\n", GetLastError());
+        return false;
+    }
+
+    // Reads are overlapped so disconnect() can wake the thread instead of waiting for a report
     connected = true;
-    std::thread inputThread([this]() {
+    startOutputThread();
+    inputThread = std::thread([this, handle = hidDevice, wakeEvent = inputWakeEvent]() {
+        ThreadPolicy::Apply(ThreadRole::DeviceInput);
         uint8_t buffer[65];
-        DWORD bytesRead;
-        while (connected && hidDevice != INVALID_HANDLE_VALUE) {
-            BOOL result = ReadFile(hidDevice, buffer, sizeof(buffer), &bytesRead, nullptr);
-            if (result && bytesRead > 0 && connected) {
-                InputReportCallback(this, bytesRead, buffer);
-            } else if (!result) {
+        OVERLAPPED overlapped = {};
+        overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+        HANDLE waitHandles[2] = {overlapped.hEvent, wakeEvent};
+
+        while (connected && overlapped.hEvent) {
+            ResetEvent(overlapped.hEvent);
+            DWORD bytesRead = 0;
+            if (!ReadFile(handle, buffer, sizeof(buffer), nullptr, &overlapped) && GetLastError() != ERROR_IO_PENDING) {
                 DWORD error = GetLastError();
                 if (error != ERROR_DEVICE_NOT_CONNECTED) {
                     debug_force("ReadFile failed with error: %lu\n", error);
                 }
+                markLost();
+                break;
+            }
+
+            if (WaitForMultipleObjects(2, waitHandles, FALSE, INFINITE) != WAIT_OBJECT_0) {
+                // Woken by disconnect(), the pending read must finish before the buffer goes away
+                CancelIoEx(handle, &overlapped);
+                GetOverlappedResult(handle, &overlapped, &bytesRead, TRUE);
+                break;
+            }
+
+            if (!GetOverlappedResult(handle, &overlapped, &bytesRead, FALSE)) {
+                DWORD error = GetLastError();
+                if (error != ERROR_DEVICE_NOT_CONNECTED && error != ERROR_OPERATION_ABORTED) {
+                    debug_force("ReadFile failed with error: %lu\n", error);
+                }
+                if (error != ERROR_OPERATION_ABORTED) {
+                    markLost();
+                }
                 break;
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            if (bytesRead > 0 && connected) {
+                InputReportCallback(this, bytesRead, buffer);
+            }
+        }
+
+        if (overlapped.hEvent) {
+            CloseHandle(overlapped.hEvent);
         }
     });
-    inputThread.detach();
 
     return true;
 }
@@ -84,39 +122,113 @@ void USBDevice::update() {
 }
 
 void USBDevice::disconnect() {
+    // Flush queued output while the device is still open
+    stopOutputThread();
+
     connected = false;
+    stopInputThread();
 
     if (hidDevice != INVALID_HANDLE_VALUE) {
         CloseHandle(hidDevice);
         hidDevice = INVALID_HANDLE_VALUE;
     }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-
     if (inputBuffer) {
         delete[] inputBuffer;
         inputBuffer = nullptr;
     }
 }
 
-bool USBDevice::writeData(std::vector<uint8_t> data) {
-    if (hidDevice == INVALID_HANDLE_VALUE || !connected || data.empty()) {
+bool USBDevice::transmitReport(std::span<const uint8_t> report) {
+    if (hidDevice == INVALID_HANDLE_VALUE || !connected || report.empty()) {
         debug_force("HID device not open, not connected, or empty data\n");
         return false;
     }
 
-    if (data.size() > 1024) {
-        debug_force("Data size too large: %zu bytes\n", data.size());
+    if (report.size() > 1024) {
+        debug_force("Data size too large: %zu bytes\n", report.size());
         return false;
     }
 
-    DWORD bytesWritten;
-    BOOL result = WriteFile(hidDevice, data.data(), (DWORD) data.size(), &bytesWritten, nullptr);
-    if (!result || bytesWritten < data.size()) {
-        DWORD error = GetLastError();
-        debug_force("WriteFile failed: %lu (expected %zu bytes, wrote %lu)\n", error, data.size(), bytesWritten);
+    // The handle is opened for overlapped I/O, so wait for the write here to keep it synchronous
+    OVERLAPPED overlapped = {};
+    overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (!overlapped.hEvent) {
+        debug_force("Failed to create write event: %lu\n", GetLastError());
+        return false;
+    }
+
+    DWORD bytesWritten = 0;
+    BOOL result = WriteFile(hidDevice, report.data(), (DWORD) report.size(), nullptr, &overlapped);
+    if (result || GetLastError() == ERROR_IO_PENDING) {
+        result = GetOverlappedResult(hidDevice, &overlapped, &bytesWritten, TRUE);
+    }
+    DWORD error = result ? ERROR_SUCCESS : GetLastError();
+    CloseHandle(overlapped.hEvent);
+
+    if (!result || bytesWritten < report.size()) {
+        int suppressed = 0;
+        if (writeFailureLog.allow(suppressed)) {
+            debug_force("WriteFile failed: %lu (expected %zu bytes, wrote %lu, %d similar errors suppressed)\n", error, report.size(), bytesWritten, suppressed);
+        }
         return false;
     }
     return true;
 }
+
+bool USBDevice::requestInputReport(uint8_t reportId) {
+    if (hidDevice == INVALID_HANDLE_VALUE || !connected) {
+        return false;
+    }
+
+    // HidD_GetInputReport wants a buffer of exactly the device's input report length
+    PHIDP_PREPARSED_DATA preparsedData = nullptr;
+    HIDP_CAPS caps = {};
+    if (!HidD_GetPreparsedData(hidDevice, &preparsedData)) {
+        return false;
+    }
+    NTSTATUS status = HidP_GetCaps(preparsedData, &caps);
+    HidD_FreePreparsedData(preparsedData);
+    if (status != HIDP_STATUS_SUCCESS || caps.InputReportByteLength == 0) {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(caps.InputReportByteLength, 0);
+    buffer[0] = reportId;
+    if (!HidD_GetInputReport(hidDevice, buffer.data(), (ULONG) buffer.size())) {
+        debug("HidD_GetInputReport failed for report 0x%02X: %lu\n", reportId, GetLastError());
+        return false;
+    }
+
+    InputReportCallback(this, (DWORD) buffer.size(), buffer.data());
+    return true;
+}
+
+void USBDevice::replayInputReport(std::span<const uint8_t> report) {
+    std::vector<uint8_t> buffer(report.begin(), report.end());
+    InputReportCallback(this, (DWORD) buffer.size(), buffer.data());
+}
+
+// disconnect() closed the handle, so the interface path is opened again.
+bool USBDevice::reopen(HIDDeviceHandle previousHandle) {
+    if (!devicePath.empty()) {
+        hidDevice = CreateFileA(devicePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr);
+    }
+    return hidDevice != INVALID_HANDLE_VALUE;
+}
+
+void USBDevice::stopInputThread() {
+    if (inputWakeEvent) {
+        SetEvent(inputWakeEvent);
+    }
+
+    if (inputThread.joinable()) {
+        inputThread.join();
+    }
+
+    if (inputWakeEvent) {
+        CloseHandle(inputWakeEvent);
+        inputWakeEvent = nullptr;
+    }
+}
 #endif
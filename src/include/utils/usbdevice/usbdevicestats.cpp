@@ -0,0 +1,136 @@
+#include "usbdevicestats.h"
+
+#include "dataref.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+USBDeviceStats::~USBDeviceStats() {
+    unpublish();
+}
+
+void USBDeviceStats::countInputReport() {
+    reportsIn.fetch_add(1, std::memory_order_relaxed);
+}
+
+void USBDeviceStats::countWrite(size_t bytes, std::chrono::steady_clock::duration latency) {
+    reportsOut.fetch_add(1, std::memory_order_relaxed);
+    bytesOut.fetch_add(bytes, std::memory_order_relaxed);
+
+    auto latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    size_t bucket = std::upper_bound(WriteLatencyLimitsUs.begin(), WriteLatencyLimitsUs.end(), latencyUs) - WriteLatencyLimitsUs.begin();
+    writeLatency[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void USBDeviceStats::countFailedWrite() {
+    failedWrites.fetch_add(1, std::memory_order_relaxed);
+}
+
+void USBDeviceStats::countInputDrop() {
+    inputDrops.fetch_add(1, std::memory_order_relaxed);
+}
+
+void USBDeviceStats::countOutputDrop() {
+    outputDrops.fetch_add(1, std::memory_order_relaxed);
+}
+
+void USBDeviceStats::noteInputQueueDepth(size_t depth) {
+    size_t highWater = inputQueueHighWater.load(std::memory_order_relaxed);
+    while (depth > highWater && !inputQueueHighWater.compare_exchange_weak(highWater, depth, std::memory_order_relaxed)) {
+    }
+}
+
+void USBDeviceStats::publish(const std::string &deviceName) {
+    unpublish();
+    refresh();
+    publishedName = deviceName;
+
+    std::string prefix = "winwing/stats/" + deviceName + "/";
+    auto createInt = [&](const std::string &name, int *value) {
+        publishedRefs.push_back(prefix + name);
+        Dataref::getInstance()->createDataref<int>(publishedRefs.back().c_str(), value);
+    };
+
+    createInt("reports_in", &published.reportsIn);
+    createInt("reports_out", &published.reportsOut);
+    createInt("failed_writes", &published.failedWrites);
+    createInt("input_drops", &published.inputDrops);
+    createInt("output_drops", &published.outputDrops);
+    createInt("input_queue_high_water", &published.inputQueueHighWater);
+
+    // Doubles hold byte counts well past what an int dataref would wrap at
+    publishedRefs.push_back(prefix + "bytes_out");
+    Dataref::getInstance()->createDataref<double>(publishedRefs.back().c_str(), &published.bytesOut);
+
+    for (size_t i = 0; i < WriteLatencyBuckets; ++i) {
+        char name[64];
+        if (i < WriteLatencyLimitsUs.size()) {
+            snprintf(name, sizeof(name), "write_latency/under_%uus", WriteLatencyLimitsUs[i]);
+        } else {
+            snprintf(name, sizeof(name), "write_latency/over_%uus", WriteLatencyLimitsUs.back());
+        }
+        createInt(name, &published.writeLatency[i]);
+    }
+}
+
+void USBDeviceStats::unpublish() {
+    for (const auto &ref : publishedRefs) {
+        Dataref::getInstance()->unbind(ref.c_str());
+    }
+    publishedRefs.clear();
+    publishedName.clear();
+}
+
+void USBDeviceStats::refresh() {
+    published.reportsIn = (int) reportsIn.load(std::memory_order_relaxed);
+    published.reportsOut = (int) reportsOut.load(std::memory_order_relaxed);
+    published.bytesOut = (double) bytesOut.load(std::memory_order_relaxed);
+    published.failedWrites = (int) failedWrites.load(std::memory_order_relaxed);
+    published.inputDrops = (int) inputDrops.load(std::memory_order_relaxed);
+    published.outputDrops = (int) outputDrops.load(std::memory_order_relaxed);
+    published.inputQueueHighWater = (int) inputQueueHighWater.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < WriteLatencyBuckets; ++i) {
+        published.writeLatency[i] = (int) writeLatency[i].load(std::memory_order_relaxed);
+    }
+}
+
+const std::string &USBDeviceStats::name() {
+    return publishedName;
+}
+
+std::string USBDeviceStats::summary() {
+    refresh();
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "in: %d reports, out: %d reports / %.0f bytes, failed writes: %d, drops in/out: %d/%d, input queue high water: %d, write latency:",
+             published.reportsIn, published.reportsOut, published.bytesOut, published.failedWrites, published.inputDrops, published.outputDrops, published.inputQueueHighWater);
+
+    std::string result = buffer;
+    for (size_t i = 0; i < WriteLatencyBuckets; ++i) {
+        if (i < WriteLatencyLimitsUs.size()) {
+            snprintf(buffer, sizeof(buffer), " <%uus: %d", WriteLatencyLimitsUs[i], published.writeLatency[i]);
+        } else {
+            snprintf(buffer, sizeof(buffer), " >%uus: %d", WriteLatencyLimitsUs.back(), published.writeLatency[i]);
+        }
+        result += buffer;
+    }
+    return result;
+}
+
+// "WINWING MCDU-32-CAPTAIN" becomes "winwing_mcdu_32_captain"
+std::string USBDeviceStats::DatarefName(const std::string &productName) {
+    std::string result;
+    for (char c : productName) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            result += (char) std::tolower(static_cast<unsigned char>(c));
+        } else if (!result.empty() && result.back() != '_') {
+            result += '_';
+        }
+    }
+
+    while (!result.empty() && result.back() == '_') {
+        result.pop_back();
+    }
+    return result.empty() ? "device" : result;
+}
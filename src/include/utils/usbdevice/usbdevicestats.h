@@ -0,0 +1,66 @@
+#ifndef USBDEVICESTATS_H
+#define USBDEVICESTATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// I/O counters of one USBDevice. The I/O threads only do relaxed atomic increments; refresh()
+// copies them into plain values on the main thread, which is what the winwing/stats/<device>/...
+// datarefs read.
+class USBDeviceStats {
+    public:
+        // Upper bounds of the write latency buckets, in microseconds. Anything slower lands in a last, open ended bucket.
+        static constexpr std::array<uint32_t, 7> WriteLatencyLimitsUs = {250, 500, 1000, 2000, 4000, 8000, 16000};
+        static constexpr size_t WriteLatencyBuckets = WriteLatencyLimitsUs.size() + 1;
+
+    private:
+        struct Published {
+                int reportsIn = 0;
+                int reportsOut = 0;
+                double bytesOut = 0;
+                int failedWrites = 0;
+                int inputDrops = 0;
+                int outputDrops = 0;
+                int inputQueueHighWater = 0;
+                std::array<int, WriteLatencyBuckets> writeLatency = {};
+        };
+
+        std::atomic<uint64_t> reportsIn = 0;
+        std::atomic<uint64_t> reportsOut = 0;
+        std::atomic<uint64_t> bytesOut = 0;
+        std::atomic<uint64_t> failedWrites = 0;
+        std::atomic<uint64_t> inputDrops = 0;
+        std::atomic<uint64_t> outputDrops = 0;
+        std::atomic<size_t> inputQueueHighWater = 0;
+        std::array<std::atomic<uint64_t>, WriteLatencyBuckets> writeLatency = {};
+
+        Published published;
+        std::string publishedName;
+        std::vector<std::string> publishedRefs;
+
+    public:
+        ~USBDeviceStats();
+
+        void countInputReport();
+        void countWrite(size_t bytes, std::chrono::steady_clock::duration latency);
+        void countFailedWrite();
+        void countInputDrop();
+        void countOutputDrop();
+        void noteInputQueueDepth(size_t depth);
+
+        // Main thread only
+        void publish(const std::string &deviceName);
+        void unpublish();
+        void refresh();
+        const std::string &name();
+        std::string summary();
+
+        static std::string DatarefName(const std::string &productName);
+};
+
+#endif
@@ -0,0 +1,112 @@
+#include "usboutputqueue.h"
+
+#include <algorithm>
+
+namespace {
+    // Sized so a full MCDU frame fits in the display lane and a complete font upload
+    // (just under 600 packets) fits in the bulk lane without blocking the caller.
+    constexpr std::array<size_t, 3> laneCapacities = {32, 128, 640};
+}
+
+USBOutputQueue::USBOutputQueue() {
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        lanes[i].slots.resize(laneCapacities[i]);
+    }
+}
+
+bool USBOutputQueue::push(std::span<const uint8_t> report, USBWritePriority priority, std::chrono::milliseconds maxWait) {
+    if (report.empty() || report.size() > MaxReportSize) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    Lane &lane = lanes[static_cast<size_t>(priority)];
+    bool hasSpace = spaceAvailable.wait_for(lock, maxWait, [&] {
+        return closed || lane.count < lane.slots.size();
+    });
+
+    if (closed || !hasSpace) {
+        return false;
+    }
+
+    OutputReport &slot = lane.slots[(lane.head + lane.count) % lane.slots.size()];
+    std::copy(report.begin(), report.end(), slot.data.begin());
+    slot.length = report.size();
+    lane.count++;
+
+    lock.unlock();
+    reportAvailable.notify_one();
+    return true;
+}
+
+bool USBOutputQueue::pop(OutputReport &report) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto pending = [&] {
+        return std::any_of(lanes.begin(), lanes.end(), [](const Lane &lane) {
+            return lane.count > 0;
+        });
+    };
+    reportAvailable.wait(lock, [&] {
+        return closed || pending();
+    });
+
+    // Once closed, keep handing out what is left so the last LED/display writes still reach the device.
+    for (Lane &lane : lanes) {
+        if (lane.count == 0) {
+            continue;
+        }
+
+        report = lane.slots[lane.head];
+        lane.head = (lane.head + 1) % lane.slots.size();
+        lane.count--;
+
+        lock.unlock();
+        spaceAvailable.notify_all();
+        return true;
+    }
+
+    return false;
+}
+
+size_t USBOutputQueue::pendingCount(USBWritePriority priority) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return lanes[static_cast<size_t>(priority)].count;
+}
+
+void USBOutputQueue::open() {
+    std::lock_guard<std::mutex> lock(mutex);
+    closed = false;
+}
+
+void USBOutputQueue::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    reportAvailable.notify_all();
+    spaceAvailable.notify_all();
+}
+
+bool USBOutputQueue::isClosed() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+// Used by the output thread to back off between failed writes without holding up close().
+bool USBOutputQueue::waitUntilClosed(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return reportAvailable.wait_for(lock, timeout, [this] {
+        return closed;
+    });
+}
+
+void USBOutputQueue::discardPending() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Lane &lane : lanes) {
+            lane.head = 0;
+            lane.count = 0;
+        }
+    }
+    spaceAvailable.notify_all();
+}
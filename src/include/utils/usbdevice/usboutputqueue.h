@@ -0,0 +1,57 @@
+#ifndef USBOUTPUTQUEUE_H
+#define USBOUTPUTQUEUE_H
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <vector>
+
+enum class USBWritePriority : unsigned char {
+    Interactive, // LEDs, vibration and other direct feedback to a key press
+    Display,     // Screen frames and 7-segment updates
+    Bulk,        // Font uploads, display configuration and other transfers that must arrive in order
+};
+
+struct OutputReport {
+        std::array<uint8_t, 128> data;
+        size_t length;
+};
+
+// Fixed-capacity output queue with one ring per priority. pop() always returns the
+// oldest report of the highest non-empty priority, so a bulk transfer is preempted
+// between two of its packets as soon as anything more important is queued.
+class USBOutputQueue {
+    private:
+        struct Lane {
+                std::vector<OutputReport> slots;
+                size_t head = 0;
+                size_t count = 0;
+        };
+
+        std::array<Lane, 3> lanes;
+        std::mutex mutex;
+        std::condition_variable reportAvailable;
+        std::condition_variable spaceAvailable;
+        bool closed = false;
+
+    public:
+        static constexpr size_t MaxReportSize = std::tuple_size_v<decltype(OutputReport::data)>;
+
+        USBOutputQueue();
+
+        // Waits up to maxWait while the lane is full, after that the report is dropped.
+        bool push(std::span<const uint8_t> report, USBWritePriority priority, std::chrono::milliseconds maxWait);
+        bool pop(OutputReport &report);
+        size_t pendingCount(USBWritePriority priority);
+        void open();
+        void close();
+        bool isClosed();
+        bool waitUntilClosed(std::chrono::milliseconds timeout);
+        void discardPending();
+};
+
+#endif
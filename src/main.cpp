@@ -5,11 +5,17 @@
 #include "appstate.h"
 #include "config.h"
 #include "dataref.h"
+#include "hidcapture.h"
+#include "hidreplay.h"
+#include "path.h"
+#include "threadpolicy.h"
 #include "usbcontroller.h"
 
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <ctime>
+#include <filesystem>
 #include <XPLMDisplay.h>
 #include <XPLMMenus.h>
 #include <XPLMPlugin.h>
@@ -36,6 +42,7 @@ void menuAction(void *mRef, void *iRef);
 
 XPLMMenuID mainMenuId;
 int debugLoggingMenuItemIndex;
+int hidCaptureMenuItemIndex;
 
 PLUGIN_API int XPluginStart(char *name, char *sig, char *desc) {
     strcpy(name, FRIENDLY_NAME);
@@ -50,6 +57,10 @@ PLUGIN_API int XPluginStart(char *name, char *sig, char *desc) {
     XPLMAppendMenuItem(mainMenuId, "Reload devices", (void *) "ActionReloadDevices", 0);
     debugLoggingMenuItemIndex = XPLMAppendMenuItem(mainMenuId, "Enable debug logging", (void *) "ActionToggleDebugLogging", 0);
     XPLMCheckMenuItem(mainMenuId, debugLoggingMenuItemIndex, xplm_Menu_Unchecked);
+    XPLMAppendMenuSeparator(mainMenuId);
+    hidCaptureMenuItemIndex = XPLMAppendMenuItem(mainMenuId, "Start HID capture", (void *) "ActionToggleHIDCapture", 0);
+    XPLMAppendMenuItem(mainMenuId, "Replay last HID capture", (void *) "ActionReplayHIDCapture", 0);
+    XPLMAppendMenuItem(mainMenuId, "Replay last HID capture (fast)", (void *) "ActionReplayHIDCaptureFast", 0);
 
     debug_force("Plugin started (version %s)\n", VERSION);
 
@@ -90,7 +101,8 @@ PLUGIN_API void XPluginReceiveMessage(XPLMPluginID from, long msg, void *params)
                 return;
             }
 
-            USBController::getInstance()->disconnectAllDevices();
+            // Keep the devices open, the next aircraft only needs new profiles.
+            USBController::getInstance()->unloadAllProfiles();
             break;
         }
 
@@ -125,10 +137,42 @@ void menuAction(void *mRef, void *iRef) {
             debug_force("Debug logging was enabled. Currently connected devices (%lu):\n", USBController::getInstance()->devices.size());
 
             for (auto &device : USBController::getInstance()->devices) {
-                debug_force("- (vendorId: 0x%04X, productId: 0x%04X, handler: %s) %s\n", device->vendorId, device->productId, device->classIdentifier(), device->productName.c_str());
+                debug_force("- (vendorId: 0x%04X, productId: 0x%04X, handler: %s, health: %s) %s\n", device->vendorId, device->productId, device->classIdentifier(), USBDevice::HealthName(device->health), device->productName.c_str());
+                debug_force("  winwing/stats/%s: %s\n", device->stats.name().c_str(), device->stats.summary().c_str());
+            }
+
+            debug_force("Plugin threads:\n");
+            for (const auto &policy : ThreadPolicy::AppliedPolicies()) {
+                debug_force("- %s\n", policy.c_str());
             }
         } else {
             debug_force("Debug logging was disabled.\n");
         }
+    } else if (!strcmp((char *) iRef, "ActionToggleHIDCapture")) {
+        if (HIDCapture::getInstance()->isActive()) {
+            HIDCapture::getInstance()->stop();
+        } else {
+            char filename[64];
+            std::time_t now = std::time(nullptr);
+            std::strftime(filename, sizeof(filename), "hid-%Y%m%d-%H%M%S.wwcap", std::localtime(&now));
+
+            Path::getInstance()->reloadPaths();
+            HIDCapture::getInstance()->start((std::filesystem::path(Path::getInstance()->rootDirectory) / "Output" / "winwing" / filename).string());
+        }
+
+        XPLMSetMenuItemName(mainMenuId, hidCaptureMenuItemIndex, HIDCapture::getInstance()->isActive() ? "Stop HID capture" : "Start HID capture", 0);
+    } else if (!strcmp((char *) iRef, "ActionReplayHIDCapture") || !strcmp((char *) iRef, "ActionReplayHIDCaptureFast")) {
+        if (HIDCapture::getInstance()->lastPath().empty()) {
+            debug_force("No HID capture to replay yet, start and stop one first\n");
+            return;
+        }
+
+        // Replaying into the capture that is being replayed would never end
+        if (HIDCapture::getInstance()->isActive()) {
+            HIDCapture::getInstance()->stop();
+            XPLMSetMenuItemName(mainMenuId, hidCaptureMenuItemIndex, "Start HID capture", 0);
+        }
+
+        HIDReplay::getInstance()->start(HIDCapture::getInstance()->lastPath(), !strcmp((char *) iRef, "ActionReplayHIDCapture"));
     }
 }
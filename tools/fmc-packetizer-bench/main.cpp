@@ -0,0 +1,227 @@
+// Encodes the same full 14 x 24 MCDU frame over and over and writes its 0xf2 reports to a
+// LoopbackTransport, once per way of packetizing: the vector the plugin used to build and cut
+// up, the same vector reserved and copied out in chunks, and FMCPacketizer. Every cell goes
+// through a std::map color lookup and a virtual glyph mapper, as mapCharacter() did.
+//
+//   fmc-packetizer-bench [frames]
+//
+// Prints the time per frame for encoding alone and with the writes, and checks that all of
+// them hand the transport the same reports.
+#include "fmc-packetizer.h"
+#include "fmc-screen.h"
+#include "loopbacktransport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Cell {
+            char glyph;
+            char color;
+            bool fontSmall;
+    };
+
+    class GlyphMapper {
+        public:
+            virtual ~GlyphMapper() = default;
+            virtual void mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool isFontSmall) = 0;
+            virtual void mapCharacter(FMCPacketizer *buffer, uint8_t character, bool isFontSmall) = 0;
+    };
+
+    // Arrows and degree signs go out as UTF-8, like the profiles map them
+    class ProfileLikeMapper : public GlyphMapper {
+        public:
+            void mapCharacter(std::vector<uint8_t> *buffer, uint8_t character, bool) override {
+                map(buffer, character);
+            }
+
+            void mapCharacter(FMCPacketizer *buffer, uint8_t character, bool) override {
+                map(buffer, character);
+            }
+
+        private:
+            template <typename Buffer>
+            void map(Buffer *buffer, uint8_t character) {
+                switch (character) {
+                    case '#':
+                        buffer->push_back(0xe2);
+                        buffer->push_back(0x98);
+                        buffer->push_back(0x90);
+                        break;
+                    case '`':
+                        buffer->push_back(0xc2);
+                        buffer->push_back(0xb0);
+                        break;
+                    case '<':
+                    case '>':
+                        buffer->push_back(0xe2);
+                        buffer->push_back(0x86);
+                        buffer->push_back(character == '<' ? 0x90 : 0x92);
+                        break;
+                    default:
+                        buffer->push_back(character);
+                }
+            }
+    };
+
+    const std::map<char, int> colorMap = {
+        {'a', 0x0021},
+        {'w', 0x0042},
+        {'c', 0x0063},
+        {'g', 0x0084},
+        {'m', 0x00a5},
+        {'r', 0x00c6},
+        {'y', 0x00e7},
+        {'e', 0x0129},
+    };
+
+    std::vector<Cell> makeFrame() {
+        const char glyphs[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789<>#`/.- ";
+        const char colors[] = "awcgmrye";
+
+        std::vector<Cell> cells;
+        for (unsigned int i = 0; i < FMCScreen::Lines * FMCScreen::CharsPerLine; ++i) {
+            cells.push_back({glyphs[(i * 7) % (sizeof(glyphs) - 1)], colors[(i / 5) % (sizeof(colors) - 1)], (i / FMCScreen::CharsPerLine) % 2 == 1});
+        }
+        return cells;
+    }
+
+    template <typename Buffer>
+    void encodeCells(const std::vector<Cell> &cells, GlyphMapper &mapper, Buffer &buffer) {
+        for (const Cell &cell : cells) {
+            auto it = colorMap.find(cell.color);
+            int color = it != colorMap.end() ? it->second : 0x0042;
+            if (cell.fontSmall) {
+                color += 0x016b;
+            }
+            buffer.push_back(color & 0xff);
+            buffer.push_back((color >> 8) & 0xff);
+            mapper.mapCharacter(&buffer, cell.glyph, cell.fontSmall);
+        }
+    }
+
+    // How the plugin first did it: a fresh vector, cut up from the front
+    void sendErasingFront(const std::vector<Cell> &cells, GlyphMapper &mapper, HIDTransport *transport) {
+        std::vector<uint8_t> buffer;
+        encodeCells(cells, mapper, buffer);
+
+        while (!buffer.empty()) {
+            size_t length = std::min(buffer.size(), FMCPacketizer::PayloadPerReport);
+            std::vector<uint8_t> report(buffer.begin(), buffer.begin() + length);
+            buffer.erase(buffer.begin(), buffer.begin() + length);
+            report.insert(report.begin(), FMCPacketizer::ReportId);
+            report.resize(FMCPacketizer::ReportLength, 0);
+            if (transport) {
+                transport->write(report);
+            }
+        }
+    }
+
+    // What FMCPacketizer replaced: a reserved vector copied out in report sized chunks
+    void sendReservedVector(const std::vector<Cell> &cells, GlyphMapper &mapper, HIDTransport *transport) {
+        std::vector<uint8_t> buffer;
+        buffer.reserve(FMCPacketizer::MaxFrameBytes);
+        encodeCells(cells, mapper, buffer);
+
+        std::vector<uint8_t> report(FMCPacketizer::ReportLength);
+        for (size_t offset = 0; offset < buffer.size(); offset += FMCPacketizer::PayloadPerReport) {
+            size_t length = std::min(buffer.size() - offset, FMCPacketizer::PayloadPerReport);
+            report[0] = FMCPacketizer::ReportId;
+            std::copy_n(buffer.begin() + offset, length, report.begin() + 1);
+            std::fill(report.begin() + 1 + length, report.end(), 0);
+            if (transport) {
+                transport->write(report);
+            }
+        }
+    }
+
+    void sendPacketizer(const std::vector<Cell> &cells, GlyphMapper &mapper, HIDTransport *transport) {
+        static FMCPacketizer packetizer;
+        packetizer.begin();
+        encodeCells(cells, mapper, packetizer);
+        packetizer.finish();
+
+        if (transport) {
+            for (size_t i = 0; i < packetizer.reportCount(); ++i) {
+                transport->write(packetizer.report(i));
+            }
+        }
+    }
+
+    using Sender = void (*)(const std::vector<Cell> &, GlyphMapper &, HIDTransport *);
+
+    double microsecondsPerFrame(Sender send, const std::vector<Cell> &cells, GlyphMapper &mapper, LoopbackTransport *transport, int frames) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; ++i) {
+            send(cells, mapper, transport);
+            if (transport && i % 64 == 63) {
+                transport->takeWrites();
+            }
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (transport) {
+            transport->takeWrites();
+        }
+
+        return std::chrono::duration<double, std::micro>(elapsed).count() / frames;
+    }
+
+    std::vector<std::vector<uint8_t>> reportsOf(Sender send, const std::vector<Cell> &cells, GlyphMapper &mapper, LoopbackTransport &transport) {
+        transport.takeWrites();
+        send(cells, mapper, &transport);
+
+        std::vector<std::vector<uint8_t>> reports;
+        for (auto &write : transport.takeWrites()) {
+            reports.push_back(std::move(write.data));
+        }
+        return reports;
+    }
+}
+
+int main(int argc, char **argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 20000;
+    if (frames <= 0) {
+        fprintf(stderr, "usage: %s [frames]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<Cell> cells = makeFrame();
+    ProfileLikeMapper mapper;
+    LoopbackTransport transport("fmc-packetizer-bench");
+    transport.open();
+
+    struct Variant {
+            const char *name;
+            Sender send;
+    };
+    const Variant variants[] = {
+        {"push_back + erase front + insert 0xf2", sendErasingFront},
+        {"reserved vector + chunk copy", sendReservedVector},
+        {"FMCPacketizer", sendPacketizer},
+    };
+
+    auto expected = reportsOf(sendPacketizer, cells, mapper, transport);
+    printf("%d frames of %zu reports, us per frame\n\n", frames, expected.size());
+    printf("%-40s %10s %14s\n", "", "encode", "encode+write");
+
+    bool identical = true;
+    for (const Variant &variant : variants) {
+        if (reportsOf(variant.send, cells, mapper, transport) != expected) {
+            fprintf(stderr, "%s does not produce the same reports\n", variant.name);
+            identical = false;
+        }
+
+        // One untimed round first, so every variant starts warm
+        microsecondsPerFrame(variant.send, cells, mapper, nullptr, std::max(1, frames / 10));
+        double encode = microsecondsPerFrame(variant.send, cells, mapper, nullptr, frames);
+        double encodeAndWrite = microsecondsPerFrame(variant.send, cells, mapper, &transport, frames);
+        printf("%-40s %10.2f %14.2f\n", variant.name, encode, encodeAndWrite);
+    }
+
+    return identical ? 0 : 1;
+}
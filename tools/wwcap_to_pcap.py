@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+# Converts an HID capture written by the plugin (Plugins > Winwing > Start HID capture, saved as
+# Output/winwing/hid-*.wwcap) into a Linux usbmon pcap that Wireshark opens directly, so the
+# dissectors in tools/wireshark work on it like on a live USB capture:
+#
+#   ./wwcap_to_pcap.py hid-20250101-120000.wwcap [out.pcap]
+#
+# Every device gets its own address on bus 1 and a made up device and configuration descriptor
+# (HID interface, interrupt endpoints 0x81 IN and 0x01 OUT), which is what lets Wireshark hand
+# the reports to the HID dissector and fill in usbhid.data. Inputs show up as completions on
+# 0x81, outputs as submits on 0x01. Should a Wireshark version not pick the descriptors up,
+# Decode As > USB interrupt > USBHID on the interface does the same.
+import os, struct, sys
+
+MAGIC = b'WWHIDCAP'
+VERSION = 1
+RECORD_DEVICE, RECORD_INPUT, RECORD_OUTPUT = 0, 1, 2
+
+LINKTYPE_USB_LINUX_MMAPPED = 220
+XFER_INTERRUPT, XFER_CONTROL = 1, 2
+
+# ---------- wwcap ----------
+def read_capture(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != MAGIC:
+        raise ValueError(f"{path} is not an HID capture")
+    version, = struct.unpack_from('<H', data, 8)
+    if version != VERSION:
+        raise ValueError(f"{path} is capture version {version}, this script reads {VERSION}")
+
+    offset = 10
+    while offset + 13 <= len(data):
+        kind, device, ns, length = struct.unpack_from('<BHQH', data, offset)
+        offset += 13
+        if offset + length > len(data):
+            print("capture is truncated, converting what is complete", file=sys.stderr)
+            break
+        yield kind, device, ns, data[offset:offset + length]
+        offset += length
+
+# ---------- usbmon ----------
+def usbmon_packet(urb, event, xfer, ep, devnum, ts_ns, setup=None, data=b'', length=None):
+    length = len(data) if length is None else length
+    header = struct.pack('<QBBBBHbbqiiII8siiII',
+        urb, ord(event), xfer, ep, devnum, 1,
+        0 if setup else ord('-'),               # flag_setup: 0 when setup bytes are valid
+        0 if data else ord('<' if event == 'S' else '>'),
+        ts_ns // 1_000_000_000, (ts_ns // 1000) % 1_000_000,
+        0, length, len(data), setup or b'\0' * 8,
+        0, 0, 0, 0)
+    return header + data
+
+def descriptors(vid, pid):
+    device = struct.pack('<BBHBBBBHHHBBBB', 18, 1, 0x0200, 0, 0, 0, 64, vid, pid, 0x0100, 0, 0, 0, 1)
+    config = struct.pack('<BBHBBBBB', 9, 2, 41, 1, 1, 0, 0x80, 250)
+    interface = struct.pack('<BBBBBBBBB', 9, 4, 0, 0, 2, 3, 0, 0, 0)
+    hid = struct.pack('<BBHBBBH', 9, 0x21, 0x0111, 0, 1, 0x22, 0)
+    ep_in = struct.pack('<BBBBHB', 7, 5, 0x81, 3, 64, 1)
+    ep_out = struct.pack('<BBBBHB', 7, 5, 0x01, 3, 64, 1)
+    return [(1, device), (2, config + interface + hid + ep_in + ep_out)]
+
+def convert(source, target):
+    base_ns = int(os.path.getmtime(source) * 1_000_000_000)
+    records = list(read_capture(source))
+    if records:
+        base_ns -= max(ns for _, _, ns, _ in records)
+
+    urb = 0
+    packets = []
+    names = {}
+    for kind, device, ns, payload in records:
+        devnum = device + 1
+        ts = base_ns + ns
+        urb += 1
+
+        if kind == RECORD_DEVICE:
+            vid, pid = struct.unpack_from('<HH', payload)
+            identity, name = (payload[4:].split(b'\0') + [b'', b''])[:2]
+            names[devnum] = f"{name.decode(errors='replace')} ({vid:04x}:{pid:04x}, {identity.decode(errors='replace')})"
+            for kind_id, descriptor in descriptors(vid, pid):
+                setup = struct.pack('<BBHHH', 0x80, 6, kind_id << 8, 0, len(descriptor))
+                packets.append(usbmon_packet(urb, 'S', XFER_CONTROL, 0x80, devnum, ts, setup=setup, length=len(descriptor)))
+                packets.append(usbmon_packet(urb, 'C', XFER_CONTROL, 0x80, devnum, ts, data=descriptor))
+                urb += 1
+        elif kind == RECORD_INPUT:
+            packets.append(usbmon_packet(urb, 'C', XFER_INTERRUPT, 0x81, devnum, ts, data=payload))
+        elif kind == RECORD_OUTPUT:
+            packets.append(usbmon_packet(urb, 'S', XFER_INTERRUPT, 0x01, devnum, ts, data=payload))
+            packets.append(usbmon_packet(urb, 'C', XFER_INTERRUPT, 0x01, devnum, ts, length=len(payload)))
+
+    with open(target, 'wb') as f:
+        f.write(struct.pack('<IHHiIII', 0xa1b2c3d4, 2, 4, 0, 0, 65535, LINKTYPE_USB_LINUX_MMAPPED))
+        for packet in packets:
+            ts_sec, ts_usec = struct.unpack_from('<qi', packet, 16)
+            f.write(struct.pack('<IIII', ts_sec, ts_usec, len(packet), len(packet)))
+            f.write(packet)
+
+    for devnum, name in sorted(names.items()):
+        print(f"1.{devnum}: {name}")
+    print(f"{len(packets)} packets written to {target}")
+
+# ---------- main ----------
+if __name__ == '__main__':
+    if len(sys.argv) not in (2, 3):
+        print(f"usage: {sys.argv[0]} capture.wwcap [out.pcap]", file=sys.stderr)
+        sys.exit(1)
+
+    source = sys.argv[1]
+    target = sys.argv[2] if len(sys.argv) == 3 else os.path.splitext(source)[0] + '.pcap'
+    convert(source, target)